@@ -0,0 +1,21 @@
+QT       = core concurrent
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+# The bot engines and the rules are shared with the game center, without its widgets
+include(src/GameCenter/GameCenterCore.pri)
+
+SOURCES += \
+    src/tournament/main.cpp \
+    src/tournament/Tournament.cpp
+
+HEADERS += \
+    src/tournament/Tournament.h
+
+INCLUDEPATH += $$PWD/src
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
@@ -0,0 +1,19 @@
+QT       += core testlib concurrent
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+# The rules, bots and framework types are shared with the game center
+include(src/GameCenter/GameCenter.pri)
+
+SOURCES += \
+    src/benchmarks/BenchmarkBaseline.cpp \
+    src/benchmarks/GameCenterBenchmarks.cpp
+
+HEADERS += \
+    src/benchmarks/BenchmarkBaseline.h
+
+DISTFILES += \
+    src/benchmarks/baseline.csv
+
+INCLUDEPATH += $$PWD/src
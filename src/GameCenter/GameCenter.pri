@@ -1,4 +1,4 @@
-QT       += core gui websockets
+QT       += core gui websockets concurrent
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
@@ -8,8 +8,12 @@ CONFIG += c++17
 # In order to do so, uncomment the following line.
 #DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
 
+# The rules, sessions and bot engines, without widgets
+include($$PWD/GameCenterCore.pri)
+
 SOURCES += \
     $$PWD/src/bots/AbstractBot/AbstractBot.cpp  \
+    $$PWD/src/bots/AbstractBot/BotRunner.cpp \
     $$PWD/src/games/AbstractGame/AbstractTableGame.cpp \
     $$PWD/src/games/TicTacToeGames.cpp \
     $$PWD/src/games/checkersgame.cpp \
@@ -18,16 +22,12 @@ SOURCES += \
 HEADERS += \
     $$PWD/src/GameCatalogModel.h \
     $$PWD/src/bots/AbstractBot/AbstractBot.h \
+    $$PWD/src/bots/AbstractBot/BotRunner.h \
     $$PWD/src/bots/RandomBot.h \
-    $$PWD/src/framework/types/QCircularList.h \
-    $$PWD/src/framework/types/QMatrix.h \
-    $$PWD/src/games/AbstractGame/AbstractStrategyRulesGame.h \
+    $$PWD/src/bots/AlphaBetaBot.h \
+    $$PWD/src/bots/MctsBot.h \
     $$PWD/src/games/AbstractGame/AbstractTableGame.h \
-    $$PWD/src/games/AbstractGame/Player.h \
-    $$PWD/src/games/CheckersRules.h \
-    $$PWD/src/games/GoRules.h \
     $$PWD/src/games/TicTacToeGames.h \
-    $$PWD/src/games/TicTacToeRules.h \
     $$PWD/src/games/checkersgame.h \
     $$PWD/src/games/gogames.h
 
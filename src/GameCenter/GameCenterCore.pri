@@ -0,0 +1,42 @@
+# Rules, headless sessions and bot engines: Qt Core only, shared by the game
+# center and by the command line tools
+QT       += core concurrent
+
+CONFIG += c++17
+
+SOURCES += \
+    $$PWD/src/games/AbstractGame/GameSession.cpp
+
+HEADERS += \
+    $$PWD/src/bots/AbstractBot/AbstractBotEngine.h \
+    $$PWD/src/bots/AbstractBot/ThinkingToken.h \
+    $$PWD/src/bots/RandomEngine.h \
+    $$PWD/src/bots/AlphaBetaEngine.h \
+    $$PWD/src/bots/AlphaBetaSearch.h \
+    $$PWD/src/bots/BotRegistry.h \
+    $$PWD/src/bots/MctsEngine.h \
+    $$PWD/src/bots/MctsSearch.h \
+    $$PWD/src/bots/TranspositionTable.h \
+    $$PWD/src/bots/evaluators/BoardEvaluator.h \
+    $$PWD/src/bots/evaluators/CheckersEvaluator.h \
+    $$PWD/src/bots/evaluators/EvaluatorRegistry.h \
+    $$PWD/src/bots/evaluators/GoEvaluator.h \
+    $$PWD/src/bots/evaluators/KInARowEvaluator.h \
+    $$PWD/src/framework/types/QCircularList.h \
+    $$PWD/src/framework/types/QMatrix.h \
+    $$PWD/src/framework/types/ZobristTable.h \
+    $$PWD/src/games/AbstractGame/AbstractStrategyRulesGame.h \
+    $$PWD/src/games/AbstractGame/GameSession.h \
+    $$PWD/src/games/AbstractGame/Move.h \
+    $$PWD/src/games/AbstractGame/Perft.h \
+    $$PWD/src/games/AbstractGame/Player.h \
+    $$PWD/src/games/CheckersBitboard.h \
+    $$PWD/src/games/CheckersRules.h \
+    $$PWD/src/games/GoBoard.h \
+    $$PWD/src/games/GoRules.h \
+    $$PWD/src/games/KInARowBoard.h \
+    $$PWD/src/games/RulesCatalog.h \
+    $$PWD/src/games/TicTacToeRules.h
+
+# Player.h uses the property helpers of the online services
+INCLUDEPATH += $$PWD/src $$PWD/../OnlineGameServices/src
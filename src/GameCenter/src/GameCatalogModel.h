@@ -1,11 +1,16 @@
+#ifndef GAMECATALOGMODEL_H
+#define GAMECATALOGMODEL_H
+
 #include <QAbstractListModel>
 #include <functional>
 #include <memory>
+#include <QSize>
 #include <QVariant>
 
 #include "games/TicTacToeGames.h"
 #include "games/GoGames.h"
 #include "games/CheckersGame.h"
+#include "games/RulesCatalog.h"
 
 // Typedef pour les constructeurs de jeux
 using GameFactory = std::function<std::unique_ptr<AbstractTableGame>()>;
@@ -22,10 +27,12 @@ public:
      * @brief Adds a new game to the catalog.
      * @param name The name of the game (for display).
      * @param factory A function to create instances of the game.
+     * @param rules A function to create the rules of the game, for headless sessions.
+     * @param boardSize The board size the game is played on.
      */
-    void addGame(const QString &name, GameFactory factory) {
+    void addGame(const QString &name, GameFactory factory, RulesFactory rules = {}, QSize boardSize = QSize()) {
         beginInsertRows(QModelIndex(), m_games.size(), m_games.size());
-        m_games.append({name, factory});
+        m_games.append({name, factory, rules, boardSize});
         endInsertRows();
     }
 
@@ -59,17 +66,57 @@ public:
         return {};
     }
 
+    /**
+     * @brief Finds a game by name.
+     * @param name The display name of the game.
+     * @return The row of the game, or -1 if it is not in the catalog.
+     */
+    int indexOf(const QString &name) const {
+        for (int row = 0; row < m_games.size(); ++row) {
+            if (m_games[row].name == name)
+                return row;
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Gets the name of a game.
+     */
+    QString name(int row) const { return m_games.at(row).name; }
+
+    /**
+     * @brief Gets the rules factory of a game, empty if the game cannot run headless.
+     */
+    RulesFactory rulesFactory(int row) const { return m_games.at(row).rules; }
+
+    /**
+     * @brief Gets the board size of a game (columns x rows).
+     */
+    QSize boardSize(int row) const { return m_games.at(row).boardSize; }
+
 private:
     struct Game {
         QString name;
         GameFactory factory;
+        RulesFactory rules;
+        QSize boardSize;
     };
 
     QList<Game> m_games;
 
     void initializeGames() {
-        addGame("Go", []() { return std::make_unique<GoGames>(); });
-        addGame("Tic Tac Toe", []() { return std::make_unique<TicTacToeGames>(); });
-        addGame("Checkers", []() { return std::make_unique<CheckersGame>(); });
+        // Les règles et la taille de plateau viennent du catalogue sans scène
+        const RulesCatalog rules;
+        auto addRulesGame = [this, &rules](const QString &name, GameFactory factory) {
+            const int row = rules.indexOf(name);
+            Q_ASSERT(row >= 0);
+            addGame(name, factory, rules.rulesFactory(row), rules.boardSize(row));
+        };
+        addRulesGame("Go", []() { return std::make_unique<GoGames>(); });
+        addRulesGame("Tic Tac Toe", []() { return std::make_unique<TicTacToeGames>(); });
+        addRulesGame("Gomoku", []() { return std::make_unique<TicTacToeGames>(nullptr, QSize(15, 15), 5); });
+        addRulesGame("Checkers", []() { return std::make_unique<CheckersGame>(); });
     }
 };
+
+#endif // GAMECATALOGMODEL_H
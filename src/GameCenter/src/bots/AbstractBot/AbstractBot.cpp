@@ -1,37 +1,118 @@
 #include "AbstractBot.h"
+#include "BotRunner.h"
+#include <QPointer>
 
 /**
  * @brief Constructs an AbstractBot.
+ * @param engine The thinking of the bot, shared with its worker thread.
  * @param parent The parent QObject (default: nullptr).
  */
-AbstractBot::AbstractBot(QObject* parent)
+AbstractBot::AbstractBot(std::shared_ptr<AbstractBotEngine> engine, QObject* parent)
     : Player(parent)
-    , gameScene(nullptr) {
+    , gameScene(nullptr)
+    , engine_(std::move(engine))
+    , runner_(new BotRunner(this, engine_)) {
+    connect(runner_, &BotRunner::thinkingFinished, this, &AbstractBot::thinkingFinished);
+}
 
+/**
+ * @brief Destructor for AbstractBot, cancels the thinking and waits for it.
+ */
+AbstractBot::~AbstractBot() {
+    // The worker only holds the engine and copies: nothing of the derived bot is used from here on
+    stopThinking();
 }
 
 /**
- * @brief Destructor for AbstractBot.
+ * @brief Chooses a move with the bot's engine, on the calling thread.
  */
-AbstractBot::~AbstractBot() {}
+Move AbstractBot::think(const AbstractStrategyRulesGame& rules,
+                        const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState,
+                        PlayerEnums::PlayerPosition player, const ThinkingToken& token) {
+    return engine_->think(rules, gameState, player, token);
+}
+
+/**
+ * @brief Thinks on the calling thread and plays the move in the game scene.
+ * @param gameState The current state of the game board.
+ * @return The position on the board where the bot played, or a null point.
+ */
+QPoint AbstractBot::play(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState) {
+    ThinkingToken token;
+    const Move move = think(*gameScene->rulesOfTheGame(), gameState, this->playerPosition(), token);
+    if (move.player == PlayerEnums::Unknown || !gameScene->playMove(this, move)) {
+        return QPoint();
+    }
+    return move.to;
+}
 
 /**
  * @brief Connects the bot to a game scene.
  * @param scene A pointer to the AbstractTableGame scene.
  */
 void AbstractBot::setGame(AbstractTableGame* scene) {
+    // The previous scene may already be deleted: only the connection handles are used
+    for (const QMetaObject::Connection& connection : sceneConnections_) {
+        disconnect(connection);
+    }
+    sceneConnections_.clear();
+    runner_->cancel();
     gameScene = scene;
 
     if (gameScene) {
-        // Lambda function to play if it's the bot's turn
-        auto playIfCurrentPlayer = [this]() {
-            if (gameScene->gameOpen() && gameScene->currentPlayer() == this) {
-                play(gameScene->getGameState());
+        // Thinks off the scene thread if it's the bot's turn, the move is played when found
+        // Queued calls may arrive after the scene was deleted
+        QPointer<AbstractTableGame> liveScene(gameScene);
+        auto playIfCurrentPlayer = [this, liveScene]() {
+            if (!liveScene || liveScene != gameScene) {
+                return;
+            }
+            if (liveScene->gameOpen() && liveScene->currentPlayer() == this) {
+                runner_->start(liveScene);
+            } else {
+                runner_->cancel();
             }
         };
 
-        // Connect signals to trigger bot's move logic
-        connect(gameScene, &AbstractTableGame::gameOpenChanged, this, playIfCurrentPlayer, Qt::QueuedConnection);
-        connect(gameScene, &AbstractTableGame::playerMoved, this, playIfCurrentPlayer, Qt::QueuedConnection);
+        // Connect signals to trigger bot's move logic (history changes cover undo and redo)
+        sceneConnections_ = {
+            connect(gameScene, &AbstractTableGame::gameOpenChanged, this, playIfCurrentPlayer, Qt::QueuedConnection),
+            connect(gameScene, &AbstractTableGame::playerMoved, this, playIfCurrentPlayer, Qt::QueuedConnection),
+            connect(gameScene, &AbstractTableGame::historyChanged, this, playIfCurrentPlayer, Qt::QueuedConnection)
+        };
     }
 }
+
+void AbstractBot::setThinkingTime(int milliseconds) {
+    runner_->setThinkingTime(milliseconds);
+}
+
+int AbstractBot::thinkingTime() const {
+    return runner_->thinkingTime();
+}
+
+bool AbstractBot::isThinking() const {
+    return runner_->isThinking();
+}
+
+/**
+ * @brief Asks the bot to play its best move found so far.
+ */
+void AbstractBot::moveNow() {
+    runner_->moveNow();
+}
+
+/**
+ * @brief Stops the thinking without playing (game reset).
+ */
+void AbstractBot::cancelThinking() {
+    runner_->cancel();
+}
+
+/**
+ * @brief Cancels the thinking and waits for the worker thread to return.
+ */
+void AbstractBot::stopThinking() {
+    runner_->cancel();
+    runner_->waitForFinished();
+}
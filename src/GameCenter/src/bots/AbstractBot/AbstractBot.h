@@ -3,14 +3,25 @@
 
 #include <QVector>
 #include <QObject>
+#include <memory>
 #include "games/AbstractGame/AbstractTableGame.h"
+#include "AbstractBotEngine.h"
+#include "ThinkingToken.h"
+
+class BotRunner;
 
 /**
  * @class AbstractBot
  * @brief Represents a base class for creating bots in a table game.
  *
  * AbstractBot provides a framework for implementing game-playing bots.
- * Subclasses must implement the `play` method to define the bot's logic.
+ * Subclasses hand an AbstractBotEngine to the constructor, the engine holds
+ * the bot's logic and its search state.
+ *
+ * When the bot plays in a scene, the engine thinks on a worker thread (see
+ * BotRunner) with copies of the rules and of the game state, so it must not
+ * touch the scene. The worker shares the engine and never calls the bot, so
+ * deleting a bot while it thinks is safe without any help from subclasses.
  */
 class AbstractBot : public Player {
     Q_OBJECT
@@ -18,21 +29,34 @@ class AbstractBot : public Player {
 public:
     /**
      * @brief Constructs an AbstractBot.
+     * @param engine The thinking of the bot, shared with its worker thread.
      * @param parent The parent QObject (default: nullptr).
      */
-    explicit AbstractBot(QObject* parent = nullptr);
+    explicit AbstractBot(std::shared_ptr<AbstractBotEngine> engine, QObject* parent = nullptr);
 
     /**
-     * @brief Destructor for AbstractBot.
+     * @brief Destructor for AbstractBot, cancels the thinking and waits for it.
      */
     virtual ~AbstractBot();
 
     /**
-     * @brief Pure virtual function to define the bot's move logic.
+     * @brief Chooses a move with the bot's engine, on the calling thread.
+     * @param rules The game rules.
+     * @param gameState The game state to play from.
+     * @param player The position the bot plays.
+     * @param token Raised when the move is wanted now or is no longer needed.
+     * @return The chosen move, or a default Move (Unknown player) if there is none.
+     */
+    Move think(const AbstractStrategyRulesGame& rules,
+               const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState,
+               PlayerEnums::PlayerPosition player, const ThinkingToken& token);
+
+    /**
+     * @brief Thinks on the calling thread and plays the move in the game scene.
      * @param gameState The current state of the game board.
-     * @return The position on the board where the bot decides to play.
+     * @return The position on the board where the bot played, or a null point.
      */
-    virtual QPoint play(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState) = 0;
+    QPoint play(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState);
 
     /**
      * @brief Connects the bot to a game scene.
@@ -40,15 +64,59 @@ public:
      */
     virtual void setGame(AbstractTableGame* scene);
 
+    /**
+     * @brief Sets the longest thinking time before the bot's move is forced.
+     * @param milliseconds Time limit, 0 for no limit.
+     */
+    void setThinkingTime(int milliseconds);
+    int thinkingTime() const;
+
+    /**
+     * @brief Checks whether the bot is thinking on a worker thread.
+     */
+    bool isThinking() const;
+
+    /**
+     * @brief Asks the bot to play its best move found so far.
+     */
+    void moveNow();
+
+    /**
+     * @brief Stops the thinking without playing (game reset).
+     */
+    void cancelThinking();
+
 protected:
+    /**
+     * @brief Gets the engine of the bot, for the settings of the subclasses.
+     */
+    AbstractBotEngine& engine() const { return *engine_; }
+
     AbstractTableGame* gameScene; ///< Pointer to the game scene the bot is playing in.
 
+private:
+    /**
+     * @brief Cancels the thinking and waits for the worker thread to return.
+     */
+    void stopThinking();
+
+    std::shared_ptr<AbstractBotEngine> engine_;        ///< Thinking of the bot, shared with the worker thread.
+    BotRunner* runner_;                                ///< Runs the engine off the scene thread.
+    QVector<QMetaObject::Connection> sceneConnections_; ///< Connections to the current scene.
+
 signals:
     /**
      * @brief Emitted when the bot makes a move.
      * @param position The position played by the bot.
      */
     void botPlayed(int position);
+
+    /**
+     * @brief Emitted on the bot's thread when a thinking run in a scene ends.
+     * @param elapsedMs Thinking time.
+     * @param played True if the move was played, false if it was cancelled or out of date.
+     */
+    void thinkingFinished(qint64 elapsedMs, bool played);
 };
 
 #endif // ABSTRACTBOT_H
@@ -0,0 +1,36 @@
+#ifndef ABSTRACTBOTENGINE_H
+#define ABSTRACTBOTENGINE_H
+
+#include "ThinkingToken.h"
+#include "games/AbstractGame/AbstractStrategyRulesGame.h"
+
+/**
+ * @class AbstractBotEngine
+ * @brief The thinking of a bot: its search and the data the search keeps between moves.
+ *
+ * An engine is neither a QObject nor tied to a scene. A bot shares its engine
+ * with its BotRunner, and the worker thread keeps its own reference while it
+ * thinks, so a running search never outlives the object it runs in: deleting
+ * the bot only cancels the thinking.
+ */
+class AbstractBotEngine {
+public:
+    virtual ~AbstractBotEngine() {}
+
+    /**
+     * @brief Chooses the move of a player.
+     *
+     * May be called on a worker thread; the search should return early once
+     * the token asks it to stop.
+     * @param rules A copy of the game rules, owned by the caller.
+     * @param gameState The game state to play from.
+     * @param player The position the bot plays.
+     * @param token Raised when the move is wanted now or is no longer needed.
+     * @return The chosen move, or a default Move (Unknown player) if there is none.
+     */
+    virtual Move think(const AbstractStrategyRulesGame& rules,
+                       const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState,
+                       PlayerEnums::PlayerPosition player, const ThinkingToken& token) = 0;
+};
+
+#endif // ABSTRACTBOTENGINE_H
@@ -0,0 +1,109 @@
+#include "BotRunner.h"
+#include "AbstractBot.h"
+#include <QtConcurrent>
+
+/**
+ * @brief Creates the runner of a bot.
+ * @param bot The bot to run, also the parent of the runner.
+ * @param engine The thinking of the bot.
+ */
+BotRunner::BotRunner(AbstractBot* bot, std::shared_ptr<AbstractBotEngine> engine)
+    : QObject(bot)
+    , bot_(bot)
+    , engine_(std::move(engine)) {
+    limitTimer_.setSingleShot(true);
+    connect(&limitTimer_, &QTimer::timeout, this, &BotRunner::moveNow);
+    connect(&watcher_, &QFutureWatcher<Move>::finished, this, &BotRunner::onFinished);
+}
+
+/**
+ * @brief Cancels the thinking and waits for the worker thread.
+ */
+BotRunner::~BotRunner() {
+    cancel();
+    waitForFinished();
+}
+
+/**
+ * @brief Starts thinking if it is the bot's turn in the scene.
+ * @param scene The game scene the bot plays in.
+ */
+void BotRunner::start(AbstractTableGame* scene) {
+    scene_ = scene;
+    if (isThinking()) {
+        // The position changed under the running search: start over once it returns
+        token_->cancel();
+        restartPending_ = true;
+        return;
+    }
+    if (!scene || !scene->gameOpen() || scene->currentPlayer() != bot_) {
+        return;
+    }
+
+    // The worker only sees copies: the scene can go on (or be deleted) while the bot thinks
+    snapshot_ = scene->getGameState();
+    std::shared_ptr<const AbstractStrategyRulesGame> rules = scene->rulesOfTheGame()->clone();
+    token_ = std::make_shared<ThinkingToken>();
+
+    const std::shared_ptr<AbstractBotEngine> engine = engine_;
+    const AbstractStrategyRulesGame::State state = snapshot_;
+    const PlayerEnums::PlayerPosition player = bot_->playerPosition();
+    const std::shared_ptr<ThinkingToken> token = token_;
+    watcher_.setFuture(QtConcurrent::run([engine, rules, state, player, token]() {
+        return engine->think(*rules, state, player, *token);
+    }));
+
+    clock_.start();
+    if (thinkingTimeMs_ > 0) {
+        limitTimer_.start(thinkingTimeMs_);
+    }
+    emit thinkingStarted();
+}
+
+/**
+ * @brief Stops the thinking and plays its best move so far.
+ */
+void BotRunner::moveNow() {
+    if (isThinking()) {
+        token_->requestMoveNow();
+    }
+}
+
+/**
+ * @brief Stops the thinking and drops its result.
+ */
+void BotRunner::cancel() {
+    restartPending_ = false;
+    limitTimer_.stop();
+    if (isThinking()) {
+        token_->cancel();
+    }
+}
+
+/**
+ * @brief Blocks until the worker thread returns.
+ */
+void BotRunner::waitForFinished() {
+    watcher_.waitForFinished();
+}
+
+void BotRunner::onFinished() {
+    limitTimer_.stop();
+    const qint64 elapsedMs = clock_.elapsed();
+    const Move move = watcher_.result();
+
+    if (restartPending_) {
+        restartPending_ = false;
+        emit thinkingFinished(elapsedMs, false);
+        start(scene_);
+        return;
+    }
+
+    // The result is dropped if the game moved on while the bot was thinking (undo, reset)
+    const bool upToDate = !token_->isCancelled() && scene_ && scene_->gameOpen()
+                          && scene_->currentPlayer() == bot_ && scene_->getGameState() == snapshot_;
+    // The exact move is played: a jump chain keeps the captures the bot chose
+    const bool played = upToDate && move.player != PlayerEnums::Unknown
+                        && scene_->playMove(bot_, move);
+    emit thinkingFinished(elapsedMs, played);
+}
@@ -0,0 +1,101 @@
+#ifndef BOTRUNNER_H
+#define BOTRUNNER_H
+
+#include <QElapsedTimer>
+#include <QFutureWatcher>
+#include <QObject>
+#include <QPointer>
+#include <QTimer>
+#include <memory>
+#include "AbstractBotEngine.h"
+#include "ThinkingToken.h"
+#include "games/AbstractGame/AbstractTableGame.h"
+
+class AbstractBot;
+
+/**
+ * @class BotRunner
+ * @brief Runs the thinking of a bot on the Qt global thread pool.
+ *
+ * When the bot has to play, the runner takes a snapshot of the game (state
+ * and a clone of the rules) and calls the bot's engine on a worker thread
+ * through QtConcurrent. The worker holds everything it uses (engine, rules,
+ * state and token), never the bot, so the bot can be deleted while it thinks.
+ * The chosen move is played on the scene thread once the thinking ends, if
+ * the game did not change in the meantime.
+ *
+ * A bot thinks at most once at a time: a new request made while it is still
+ * thinking cancels the running search and starts over when it returns.
+ */
+class BotRunner : public QObject {
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Creates the runner of a bot.
+     * @param bot The bot to run, also the parent of the runner.
+     * @param engine The thinking of the bot.
+     */
+    BotRunner(AbstractBot* bot, std::shared_ptr<AbstractBotEngine> engine);
+
+    /**
+     * @brief Cancels the thinking and waits for the worker thread.
+     */
+    ~BotRunner() override;
+
+    /**
+     * @brief Starts thinking if it is the bot's turn in the scene.
+     * @param scene The game scene the bot plays in.
+     */
+    void start(AbstractTableGame* scene);
+
+    /**
+     * @brief Stops the thinking and plays its best move so far.
+     */
+    void moveNow();
+
+    /**
+     * @brief Stops the thinking and drops its result.
+     */
+    void cancel();
+
+    /**
+     * @brief Blocks until the worker thread returns.
+     */
+    void waitForFinished();
+
+    bool isThinking() const { return watcher_.isRunning(); }
+
+    /**
+     * @brief Sets the longest thinking time before the move is forced.
+     * @param milliseconds Time limit, 0 for no limit.
+     */
+    void setThinkingTime(int milliseconds) { thinkingTimeMs_ = qMax(0, milliseconds); }
+    int thinkingTime() const { return thinkingTimeMs_; }
+
+signals:
+    void thinkingStarted();
+
+    /**
+     * @brief Emitted on the scene thread when the thinking ends.
+     * @param elapsedMs Thinking time.
+     * @param played True if the move was played, false if it was cancelled or out of date.
+     */
+    void thinkingFinished(qint64 elapsedMs, bool played);
+
+private:
+    void onFinished();
+
+    AbstractBot* bot_;                                  ///< The bot run, parent of the runner (scene thread only).
+    std::shared_ptr<AbstractBotEngine> engine_;         ///< Thinking of the bot, shared with the worker thread.
+    QPointer<AbstractTableGame> scene_;                 ///< Scene of the last request.
+    QFutureWatcher<Move> watcher_;                      ///< Follows the worker thread.
+    std::shared_ptr<ThinkingToken> token_;              ///< Token of the running thinking.
+    AbstractStrategyRulesGame::State snapshot_;         ///< State the running thinking started from.
+    QTimer limitTimer_;                                 ///< Forces the move after the thinking time.
+    QElapsedTimer clock_;                               ///< Measures the thinking time.
+    int thinkingTimeMs_ = 0;                            ///< Thinking time limit, 0 for none.
+    bool restartPending_ = false;                       ///< A request arrived during a cancelled thinking.
+};
+
+#endif // BOTRUNNER_H
@@ -0,0 +1,43 @@
+#ifndef THINKINGTOKEN_H
+#define THINKINGTOKEN_H
+
+#include <atomic>
+
+/**
+ * @class ThinkingToken
+ * @brief Shared between a bot thinking on a worker thread and the scene thread.
+ *
+ * The scene thread either asks for the move now (the search stops and its
+ * best move so far is played) or cancels the thinking (the search stops and
+ * its result is dropped). Searches poll stopFlag(), which is raised in both
+ * cases.
+ */
+class ThinkingToken {
+public:
+    /**
+     * @brief Stops the search and drops its result (game reset, undo, bot removed).
+     */
+    void cancel() {
+        cancelled_ = true;
+        stop_ = true;
+    }
+
+    /**
+     * @brief Stops the search and plays its best move so far.
+     */
+    void requestMoveNow() { stop_ = true; }
+
+    bool isCancelled() const { return cancelled_; }
+    bool shouldStop() const { return stop_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Flag polled by the searches, raised by cancel() and requestMoveNow().
+     */
+    const std::atomic<bool>& stopFlag() const { return stop_; }
+
+private:
+    std::atomic<bool> cancelled_{ false }; ///< The result must be dropped.
+    std::atomic<bool> stop_{ false };      ///< The search must return.
+};
+
+#endif // THINKINGTOKEN_H
@@ -0,0 +1,36 @@
+#ifndef ALPHABETABOT_H
+#define ALPHABETABOT_H
+
+#include "AbstractBot/AbstractBot.h"
+#include "AlphaBetaEngine.h"
+
+/**
+ * @class AlphaBetaBot
+ * @brief Bot playing the moves of an AlphaBetaEngine.
+ */
+class AlphaBetaBot : public AbstractBot {
+    Q_OBJECT
+
+public:
+    explicit AlphaBetaBot(QObject* parent = nullptr) : AbstractBot(std::make_shared<AlphaBetaEngine>(), parent) {}
+
+    /**
+     * @brief Sets the thinking time per move.
+     * @param milliseconds Time budget, 0 to search up to the maximum depth.
+     */
+    void setTimeBudget(int milliseconds) { engine().setTimeBudget(milliseconds); }
+    int timeBudget() const { return engine().timeBudget(); }
+
+    void setMaxDepth(int depth) { engine().setMaxDepth(depth); }
+    int maxDepth() const { return engine().maxDepth(); }
+
+    /**
+     * @brief Gets the statistics of the last search (depth, nodes, time), once the thinking finished.
+     */
+    const AlphaBetaSearch::Result& lastResult() const { return engine().lastResult(); }
+
+private:
+    AlphaBetaEngine& engine() const { return static_cast<AlphaBetaEngine&>(AbstractBot::engine()); }
+};
+
+#endif // ALPHABETABOT_H
@@ -0,0 +1,61 @@
+#ifndef ALPHABETAENGINE_H
+#define ALPHABETAENGINE_H
+
+#include "AbstractBot/AbstractBotEngine.h"
+#include "AlphaBetaSearch.h"
+#include "evaluators/EvaluatorRegistry.h"
+#include <memory>
+
+/**
+ * @class AlphaBetaEngine
+ * @brief Searches its moves with iterative deepening alpha-beta.
+ *
+ * The evaluation is picked from the EvaluatorRegistry according to the game
+ * being played. Each move is searched within the time budget, so the engine
+ * answers in bounded time whatever the game. The search also returns its best
+ * move so far when the thinking token asks for the move now.
+ */
+class AlphaBetaEngine : public AbstractBotEngine {
+public:
+    /**
+     * @brief Sets the thinking time per move.
+     * @param milliseconds Time budget, 0 to search up to the maximum depth.
+     */
+    void setTimeBudget(int milliseconds) { search_.setTimeBudget(milliseconds); }
+    int timeBudget() const { return search_.timeBudget(); }
+
+    void setMaxDepth(int depth) { search_.setMaxDepth(depth); }
+    int maxDepth() const { return search_.maxDepth(); }
+
+    /**
+     * @brief Gets the statistics of the last search (depth, nodes, time), once the thinking finished.
+     */
+    const AlphaBetaSearch::Result& lastResult() const { return lastResult_; }
+
+    Move think(const AbstractStrategyRulesGame& rules,
+               const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState,
+               PlayerEnums::PlayerPosition player, const ThinkingToken& token) override {
+        // The rules are a fresh copy for each move: the evaluator follows the game and board, not the instance
+        const QSize boardSize(gameState.cols(), gameState.rows());
+        if (!evaluator_ || evaluatorGame_ != rules.gameName() || evaluatorBoard_ != boardSize) {
+            evaluator_ = EvaluatorRegistry::create(&rules);
+            evaluatorGame_ = rules.gameName();
+            evaluatorBoard_ = boardSize;
+            search_.clear();
+        }
+
+        search_.setStopFlag(&token.stopFlag());
+        lastResult_ = search_.search(rules, gameState, player, *evaluator_);
+        search_.setStopFlag(nullptr);
+        return lastResult_.found ? lastResult_.move : Move(); // No legal move
+    }
+
+private:
+    AlphaBetaSearch search_;                          ///< Search state, kept between moves (transposition table).
+    std::unique_ptr<BoardEvaluator> evaluator_;        ///< Evaluation of the current game.
+    QString evaluatorGame_;                           ///< Game the evaluator was created for.
+    QSize evaluatorBoard_;                            ///< Board size the evaluator was created for.
+    AlphaBetaSearch::Result lastResult_;               ///< Statistics of the last search.
+};
+
+#endif // ALPHABETAENGINE_H
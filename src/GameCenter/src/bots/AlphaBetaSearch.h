@@ -0,0 +1,338 @@
+#ifndef ALPHABETASEARCH_H
+#define ALPHABETASEARCH_H
+
+#include <QElapsedTimer>
+#include <QPair>
+#include <QVector>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include "TranspositionTable.h"
+#include "evaluators/BoardEvaluator.h"
+#include "framework/types/ZobristTable.h"
+#include "games/AbstractGame/AbstractStrategyRulesGame.h"
+
+/**
+ * @class AlphaBetaSearch
+ * @brief Iterative deepening negamax with alpha-beta pruning, for two-player games.
+ *
+ * The search only talks to the rules interface (validate, apply, unapply,
+ * isGameOver, checkWin), so it plays any AbstractStrategyRulesGame. Moves are
+ * made and unmade on a single working board, with a reversible tracker for
+ * the incremental data of the rules. Positions are keyed with Zobrist
+ * hashing, updated from the move delta, and cached in a fixed-size
+ * TranspositionTable.
+ *
+ * Move ordering: the transposition table move first, then captures, then the
+ * history heuristic (moves that caused cutoffs before).
+ *
+ * Each ply has its own move buffers, cleared and refilled at every node, so
+ * once they have grown the search walks the tree without allocating.
+ *
+ * The search stops when its time budget is spent, or when its stop flag is
+ * raised, and returns the best move of the last fully searched depth.
+ */
+class AlphaBetaSearch {
+public:
+    /**
+     * @brief Outcome of a search.
+     */
+    struct Result {
+        Move move;            ///< Best move found.
+        bool found = false;   ///< False if the player has no legal move.
+        int score = 0;        ///< Score of the best move for the searching player.
+        int depth = 0;        ///< Last fully searched depth.
+        quint64 nodes = 0;    ///< Number of visited positions.
+        qint64 elapsedMs = 0; ///< Time spent searching.
+    };
+
+    /**
+     * @brief Creates a search.
+     * @param tableMegabytes Memory of the transposition table.
+     */
+    explicit AlphaBetaSearch(int tableMegabytes = 16) : table_(tableMegabytes), plies_(MaxPly + 1) {}
+
+    void setTimeBudget(int milliseconds) { timeBudgetMs_ = milliseconds; }
+    int timeBudget() const { return timeBudgetMs_; }
+
+    void setMaxDepth(int depth) { maxDepth_ = qBound(1, depth, 64); }
+    int maxDepth() const { return maxDepth_; }
+
+    /**
+     * @brief Sets a flag that stops the search when raised from another thread.
+     * @param flag The flag to poll, or null.
+     */
+    void setStopFlag(const std::atomic<bool> *flag) { stopFlag_ = flag; }
+
+    /**
+     * @brief Drops the cached positions (for a new game).
+     */
+    void clear() {
+        table_.clear();
+        history_.clear();
+    }
+
+    /**
+     * @brief Searches the best move of a player.
+     * @param rules The rules of the game.
+     * @param state The position to search from.
+     * @param player The player to move.
+     * @param evaluator The static evaluation used at the leaves.
+     * @return The best move of the deepest completed iteration.
+     */
+    Result search(const AbstractStrategyRulesGame &rules, const AbstractStrategyRulesGame::State &state,
+                  PlayerEnums::PlayerPosition player, const BoardEvaluator &evaluator) {
+        rules_ = &rules;
+        evaluator_ = &evaluator;
+        board_ = state;
+        tracker_ = rules.track(board_, true);
+        cols_ = state.cols();
+        hashed_ = state.size() <= Keys::cells();
+        history_.fill(0, state.size() * state.size());
+        nodes_ = 0;
+        aborted_ = false;
+        timer_.start();
+
+        Result result;
+        QVector<Move> &rootMoves = plies_[0].moves;
+        rules.legalMoves(board_, player, rootMoves, tracker_.get());
+        if (rootMoves.isEmpty()) {
+            return result;
+        }
+        result.found = true;
+        result.move = rootMoves.first();
+
+        const quint64 rootKey = keyOf(board_, player);
+        for (int depth = 1; depth <= maxDepth_; ++depth) {
+            int bestScore = -Infinity;
+            int bestIndex = 0;
+            int alpha = -Infinity;
+            for (int i = 0; i < rootMoves.size(); ++i) {
+                Move &move = rootMoves[i];
+                const quint64 key = makeMove(move, rootKey);
+                const int score = -negamax(depth - 1, -Infinity, -alpha, opponentOf(player), 1, key);
+                rules.unapply(board_, move, tracker_.get());
+                if (aborted_) {
+                    break;
+                }
+                if (score > bestScore) {
+                    bestScore = score;
+                    bestIndex = i;
+                    alpha = qMax(alpha, score);
+                }
+            }
+            if (aborted_) {
+                break; // Keep the result of the previous depth
+            }
+
+            // The best move is searched first at the next depth
+            std::rotate(rootMoves.begin(), rootMoves.begin() + bestIndex, rootMoves.begin() + bestIndex + 1);
+            result.move = rootMoves.first();
+            result.score = bestScore;
+            result.depth = depth;
+            if (qAbs(bestScore) >= BoardEvaluator::WinScore - MaxPly) {
+                break; // The game is decided
+            }
+        }
+
+        result.nodes = nodes_;
+        result.elapsedMs = timer_.elapsed();
+        return result;
+    }
+
+private:
+    using Keys = ZobristTable<32 * 32, 2 * 16>; ///< (cell, owner * 16 + typeId) keys for boards up to 32x32.
+
+    static constexpr int Infinity = BoardEvaluator::WinScore + 1000;
+    static constexpr int MaxPly = 128;
+    static constexpr int EvaluationLimit = BoardEvaluator::WinScore / 2;
+
+    static PlayerEnums::PlayerPosition opponentOf(PlayerEnums::PlayerPosition player) {
+        return player == PlayerEnums::Player1 ? PlayerEnums::Player2 : PlayerEnums::Player1;
+    }
+
+    int cellIndex(QPoint cell) const { return cell.y() * cols_ + cell.x(); }
+
+    quint64 cellKey(int cell, AbstractStrategyRulesGame::AtomicCellState content) const {
+        if (!hashed_ || content.position > PlayerEnums::Player2) {
+            return 0;
+        }
+        return Keys::key(cell, content.position * 16 + content.typeId);
+    }
+
+    quint64 keyOf(const AbstractStrategyRulesGame::State &state, PlayerEnums::PlayerPosition side) const {
+        if (!hashed_) {
+            return 0;
+        }
+        quint64 key = side == PlayerEnums::Player2 ? Keys::sideToMove() : 0;
+        for (int cell = 0; cell < state.size(); ++cell) {
+            key ^= cellKey(cell, state.data()[cell]);
+        }
+        return key;
+    }
+
+    // Applies a move on the working board and returns the key of the new position
+    quint64 makeMove(Move &move, quint64 key) {
+        if (!hashed_) {
+            rules_->apply(board_, move, tracker_.get());
+            return 0;
+        }
+
+        const int from = cellIndex(move.from);
+        const int to = cellIndex(move.to);
+        key ^= cellKey(from, board_.data()[from]);
+        if (to != from) {
+            key ^= cellKey(to, board_.data()[to]);
+        }
+
+        rules_->apply(board_, move, tracker_.get());
+
+        key ^= cellKey(from, board_.data()[from]);
+        if (to != from) {
+            key ^= cellKey(to, board_.data()[to]);
+        }
+        const PlayerEnums::PlayerPosition opponent = opponentOf(move.player);
+        for (int i = 0; i < move.captures.size(); ++i) {
+            key ^= cellKey(cellIndex(move.captures[i]), { opponent, move.capturedTypes.value(i) });
+        }
+        return key ^ Keys::sideToMove();
+    }
+
+    // Win scores are stored relative to the node, so they stay valid at another ply
+    static int toTable(int score, int ply) {
+        return score >= BoardEvaluator::WinScore - MaxPly ? score + ply : score <= -BoardEvaluator::WinScore + MaxPly ? score - ply : score;
+    }
+    static int fromTable(int score, int ply) {
+        return score >= BoardEvaluator::WinScore - MaxPly ? score - ply : score <= -BoardEvaluator::WinScore + MaxPly ? score + ply : score;
+    }
+
+    /**
+     * @brief Move buffers of one ply, reused by every node searched at that ply.
+     */
+    struct Ply {
+        QVector<Move> moves;              ///< Legal moves of the node, in search order.
+        QVector<Move> ordered;            ///< Scratch list swapped with moves by orderMoves().
+        QVector<QPair<int, int>> scored;  ///< (ordering score, index in moves).
+    };
+
+    void orderMoves(Ply &ply, int ttFrom, int ttTo) const {
+        QVector<Move> &moves = ply.moves;
+        QVector<QPair<int, int>> &scored = ply.scored;
+        scored.clear();
+        for (int i = 0; i < moves.size(); ++i) {
+            const int from = cellIndex(moves[i].from);
+            const int to = cellIndex(moves[i].to);
+            int score = history_.value(from * board_.size() + to);
+            score += moves[i].captures.size() * 1000000;
+            if (from == ttFrom && to == ttTo) {
+                score = std::numeric_limits<int>::max();
+            }
+            scored.append({ score, i });
+        }
+        std::stable_sort(scored.begin(), scored.end(), [](const QPair<int, int> &a, const QPair<int, int> &b) { return a.first > b.first; });
+
+        QVector<Move> &ordered = ply.ordered;
+        ordered.clear();
+        for (const QPair<int, int> &entry : scored) {
+            ordered.append(moves[entry.second]);
+        }
+        moves.swap(ordered);
+    }
+
+    int negamax(int depth, int alpha, int beta, PlayerEnums::PlayerPosition side, int ply, quint64 key) {
+        if ((++nodes_ & 1023) == 0 && ((timeBudgetMs_ > 0 && timer_.elapsed() >= timeBudgetMs_)
+                                       || (stopFlag_ && stopFlag_->load(std::memory_order_relaxed)))) {
+            aborted_ = true;
+        }
+        if (aborted_) {
+            return 0;
+        }
+
+        if (rules_->isGameOver(board_, tracker_.get())) {
+            const PlayerEnums::PlayerPosition winner = rules_->checkWin(board_, tracker_.get());
+            if (winner == PlayerEnums::Unknown) {
+                return 0;
+            }
+            return winner == side ? BoardEvaluator::WinScore - ply : -BoardEvaluator::WinScore + ply;
+        }
+        if (depth <= 0 || ply >= MaxPly) {
+            return qBound(-EvaluationLimit, evaluator_->evaluate(board_, side), EvaluationLimit);
+        }
+
+        const int originalAlpha = alpha;
+        int ttFrom = -1;
+        int ttTo = -1;
+        if (const TranspositionTable::Entry *entry = hashed_ ? table_.probe(key) : nullptr) {
+            ttFrom = entry->bestFrom;
+            ttTo = entry->bestTo;
+            if (entry->depth >= depth) {
+                const int score = fromTable(entry->score, ply);
+                if (entry->bound == TranspositionTable::Exact
+                    || (entry->bound == TranspositionTable::Lower && score >= beta)
+                    || (entry->bound == TranspositionTable::Upper && score <= alpha)) {
+                    return score;
+                }
+            }
+        }
+
+        Ply &buffers = plies_[ply];
+        QVector<Move> &moves = buffers.moves;
+        rules_->legalMoves(board_, side, moves, tracker_.get());
+        if (moves.isEmpty()) {
+            return -BoardEvaluator::WinScore + ply; // A player who cannot move loses
+        }
+        orderMoves(buffers, ttFrom, ttTo);
+
+        int bestScore = -Infinity;
+        int bestFrom = -1;
+        int bestTo = -1;
+        for (Move &move : moves) {
+            const quint64 childKey = makeMove(move, key);
+            const int score = -negamax(depth - 1, -beta, -alpha, opponentOf(side), ply + 1, childKey);
+            rules_->unapply(board_, move, tracker_.get());
+            if (aborted_) {
+                return 0;
+            }
+
+            if (score > bestScore) {
+                bestScore = score;
+                bestFrom = cellIndex(move.from);
+                bestTo = cellIndex(move.to);
+            }
+            if (score > alpha) {
+                alpha = score;
+            }
+            if (alpha >= beta) {
+                history_[bestFrom * board_.size() + bestTo] += depth * depth;
+                break;
+            }
+        }
+
+        if (hashed_) {
+            const TranspositionTable::Bound bound = bestScore <= originalAlpha ? TranspositionTable::Upper
+                                                  : bestScore >= beta ? TranspositionTable::Lower
+                                                  : TranspositionTable::Exact;
+            table_.store(key, depth, toTable(bestScore, ply), bound, bestFrom, bestTo);
+        }
+        return bestScore;
+    }
+
+    TranspositionTable table_;                    ///< Cached search results.
+    QVector<Ply> plies_;                          ///< Move buffers indexed by ply, the root at 0.
+    QVector<int> history_;                        ///< Cutoff counters indexed by from * cells + to.
+    AbstractStrategyRulesGame::State board_;      ///< Working board, moves are made and unmade on it.
+    std::unique_ptr<AbstractStrategyRulesGame::Tracker> tracker_; ///< Incremental data of board_, undone with it.
+    const AbstractStrategyRulesGame *rules_ = nullptr;
+    const BoardEvaluator *evaluator_ = nullptr;
+    QElapsedTimer timer_;
+    quint64 nodes_ = 0;
+    int cols_ = 0;
+    int timeBudgetMs_ = 1000;                     ///< Thinking time per move, 0 for no limit.
+    int maxDepth_ = 32;
+    bool hashed_ = false;                         ///< False for boards larger than the key table.
+    bool aborted_ = false;
+    const std::atomic<bool> *stopFlag_ = nullptr; ///< Raised to stop the search early.
+};
+
+#endif // ALPHABETASEARCH_H
@@ -0,0 +1,90 @@
+#ifndef BOTREGISTRY_H
+#define BOTREGISTRY_H
+
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <functional>
+#include <memory>
+#include "AbstractBot/AbstractBotEngine.h"
+#include "AlphaBetaEngine.h"
+#include "MctsEngine.h"
+#include "RandomEngine.h"
+
+/**
+ * @class BotRegistry
+ * @brief Maps a bot name to a factory creating the engine of that bot.
+ *
+ * Tools pick bots by name; the bundled bots are registered under "Random",
+ * "AlphaBeta" and "Mcts". New bots plug in with registerBot(). The registry
+ * only creates engines, so headless tools use it without any scene.
+ */
+class BotRegistry {
+public:
+    /**
+     * @brief Settings applied to a bot when it is created.
+     */
+    struct Options {
+        int timeBudget = 100; ///< Thinking time per move in milliseconds, for the searching bots.
+        int threads = 1;      ///< Search threads, for the bots searching in parallel.
+    };
+
+    using Factory = std::function<std::unique_ptr<AbstractBotEngine>(const Options &options)>;
+
+    /**
+     * @brief Registers (or replaces) a bot.
+     * @param name The name the bot is created with.
+     * @param factory Creates the configured engine of the bot.
+     */
+    static void registerBot(const QString &name, Factory factory) {
+        factories().insert(name, std::move(factory));
+    }
+
+    /**
+     * @brief Creates the engine of a bot.
+     * @param name The registered name of the bot.
+     * @param options Settings of the bot.
+     * @return The engine, or nullptr if no bot is registered under that name.
+     */
+    static std::unique_ptr<AbstractBotEngine> create(const QString &name, const Options &options) {
+        const Factory factory = factories().value(name);
+        return factory ? factory(options) : nullptr;
+    }
+
+    /**
+     * @brief Creates the engine of a bot with the default settings.
+     */
+    static std::unique_ptr<AbstractBotEngine> create(const QString &name) { return create(name, Options()); }
+
+    /**
+     * @brief Names of the registered bots, sorted.
+     */
+    static QStringList names() { return factories().keys(); }
+
+private:
+    static QMap<QString, Factory> &factories() {
+        static QMap<QString, Factory> registry = builtIns();
+        return registry;
+    }
+
+    static QMap<QString, Factory> builtIns() {
+        QMap<QString, Factory> registry;
+        registry.insert(QStringLiteral("Random"), [](const Options &) -> std::unique_ptr<AbstractBotEngine> {
+            return std::make_unique<RandomEngine>();
+        });
+        registry.insert(QStringLiteral("AlphaBeta"), [](const Options &options) -> std::unique_ptr<AbstractBotEngine> {
+            auto engine = std::make_unique<AlphaBetaEngine>();
+            engine->setTimeBudget(options.timeBudget);
+            return engine;
+        });
+        registry.insert(QStringLiteral("Mcts"), [](const Options &options) -> std::unique_ptr<AbstractBotEngine> {
+            auto engine = std::make_unique<MctsEngine>();
+            engine->setTimeBudget(options.timeBudget);
+            engine->setThreadCount(options.threads);
+            return engine;
+        });
+        return registry;
+    }
+};
+
+#endif // BOTREGISTRY_H
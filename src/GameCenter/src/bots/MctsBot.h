@@ -0,0 +1,58 @@
+#ifndef MCTSBOT_H
+#define MCTSBOT_H
+
+#include "AbstractBot/AbstractBot.h"
+#include "MctsEngine.h"
+
+/**
+ * @class MctsBot
+ * @brief Go bot playing the moves of an MctsEngine.
+ *
+ * After each Go search run in a scene, the bot emits searchFinished() with the
+ * number of playouts and the playouts per second, the figure used to size the
+ * machines hosting bot tables.
+ */
+class MctsBot : public AbstractBot {
+    Q_OBJECT
+
+public:
+    explicit MctsBot(QObject* parent = nullptr) : AbstractBot(std::make_shared<MctsEngine>(), parent) {
+        // The statistics are read on the bot's thread, once the worker thread returned
+        connect(this, &AbstractBot::thinkingFinished, this, [this]() {
+            const MctsSearch::Result& result = engine().lastResult();
+            if (result.playouts > 0) {
+                emit searchFinished(result.playouts, result.playoutsPerSecond());
+            }
+        });
+    }
+
+    /**
+     * @brief Sets the thinking time per move.
+     * @param milliseconds Time budget, 0 to rely on the playout limit only.
+     */
+    void setTimeBudget(int milliseconds) { engine().setTimeBudget(milliseconds); }
+    int timeBudget() const { return engine().timeBudget(); }
+
+    void setMaxPlayouts(quint64 playouts) { engine().setMaxPlayouts(playouts); }
+    void setThreadCount(int threads) { engine().setThreadCount(threads); }
+    int threadCount() const { return engine().threadCount(); }
+    void setKomi(double komi) { engine().setKomi(komi); }
+
+    /**
+     * @brief Gets the statistics of the last Go search, once the thinking finished.
+     */
+    const MctsSearch::Result& lastResult() const { return engine().lastResult(); }
+
+signals:
+    /**
+     * @brief Emitted on the bot's thread after each Go search run in a scene.
+     * @param playouts Number of playouts of the search.
+     * @param playoutsPerSecond Playout throughput over all worker threads.
+     */
+    void searchFinished(quint64 playouts, double playoutsPerSecond);
+
+private:
+    MctsEngine& engine() const { return static_cast<MctsEngine&>(AbstractBot::engine()); }
+};
+
+#endif // MCTSBOT_H
@@ -0,0 +1,95 @@
+#ifndef MCTSENGINE_H
+#define MCTSENGINE_H
+
+#include "AbstractBot/AbstractBotEngine.h"
+#include "AlphaBetaSearch.h"
+#include "MctsSearch.h"
+#include "evaluators/EvaluatorRegistry.h"
+#include "games/GoRules.h"
+#include <memory>
+
+/**
+ * @class MctsEngine
+ * @brief Go engine playing with a parallel Monte-Carlo Tree Search.
+ *
+ * The search tree is kept between the moves of a game. lastResult() gives the
+ * number of playouts and the playouts per second of the last Go search, the
+ * figure used to size the machines hosting bot tables.
+ *
+ * Monte-Carlo playouts are written for Go; on other games the engine falls
+ * back to an alpha-beta search with the same time budget.
+ */
+class MctsEngine : public AbstractBotEngine {
+public:
+    /**
+     * @brief Sets the thinking time per move.
+     * @param milliseconds Time budget, 0 to rely on the playout limit only.
+     */
+    void setTimeBudget(int milliseconds) {
+        search_.setTimeBudget(milliseconds);
+        fallback_.setTimeBudget(milliseconds);
+    }
+    int timeBudget() const { return search_.timeBudget(); }
+
+    void setMaxPlayouts(quint64 playouts) { search_.setMaxPlayouts(playouts); }
+    void setThreadCount(int threads) { search_.setThreadCount(threads); }
+    int threadCount() const { return search_.threadCount(); }
+    void setKomi(double komi) { search_.setKomi(komi); }
+
+    /**
+     * @brief Gets the statistics of the last Go search, once the thinking finished (no playouts after another game).
+     */
+    const MctsSearch::Result& lastResult() const { return lastResult_; }
+
+    Move think(const AbstractStrategyRulesGame& rules,
+               const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState,
+               PlayerEnums::PlayerPosition player, const ThinkingToken& token) override {
+        const auto* go = dynamic_cast<const GoRules*>(&rules);
+        if (!go) {
+            lastResult_ = MctsSearch::Result();
+            return thinkFallback(rules, gameState, player, token);
+        }
+
+        const GoBoard board = GoBoard::fromState(gameState);
+        search_.setStopFlag(&token.stopFlag());
+        lastResult_ = search_.search(board, player, go->positionHistory());
+        search_.setStopFlag(nullptr);
+
+        // The rules have the last word (superko against the whole game)
+        const std::unique_ptr<AbstractStrategyRulesGame::Tracker> tracker = go->track(gameState);
+        for (int point : lastResult_.ranked) {
+            const Move move = Move::placement(QPoint(board.colOf(point), board.rowOf(point)), player);
+            if (go->validate(gameState, move, tracker.get())) {
+                return move;
+            }
+        }
+        return Move(); // No legal move
+    }
+
+private:
+    Move thinkFallback(const AbstractStrategyRulesGame& rules,
+                       const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState,
+                       PlayerEnums::PlayerPosition player, const ThinkingToken& token) {
+        const QSize boardSize(gameState.cols(), gameState.rows());
+        if (!evaluator_ || evaluatorGame_ != rules.gameName() || evaluatorBoard_ != boardSize) {
+            evaluator_ = EvaluatorRegistry::create(&rules);
+            evaluatorGame_ = rules.gameName();
+            evaluatorBoard_ = boardSize;
+            fallback_.clear();
+        }
+
+        fallback_.setStopFlag(&token.stopFlag());
+        const AlphaBetaSearch::Result result = fallback_.search(rules, gameState, player, *evaluator_);
+        fallback_.setStopFlag(nullptr);
+        return result.found ? result.move : Move();
+    }
+
+    MctsSearch search_;                                       ///< Go search, its tree is reused between moves.
+    MctsSearch::Result lastResult_;                           ///< Statistics of the last Go search.
+    AlphaBetaSearch fallback_;                                ///< Search used for the other games.
+    std::unique_ptr<BoardEvaluator> evaluator_;               ///< Evaluation of the fallback game.
+    QString evaluatorGame_;                                   ///< Game the evaluator was created for.
+    QSize evaluatorBoard_;                                    ///< Board size the evaluator was created for.
+};
+
+#endif // MCTSENGINE_H
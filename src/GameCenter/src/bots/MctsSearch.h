@@ -0,0 +1,468 @@
+#ifndef MCTSSEARCH_H
+#define MCTSSEARCH_H
+
+#include <QElapsedTimer>
+#include <QSet>
+#include <QVector>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "games/GoBoard.h"
+
+/**
+ * @class MctsSearch
+ * @brief Parallel Monte-Carlo Tree Search for Go.
+ *
+ * Each iteration walks down the tree with UCT selection, expands the reached
+ * node and finishes the game with a light random playout (random legal moves
+ * that do not fill the player's own eyes), then backs the winner up the path.
+ *
+ * Several worker threads share a single tree. A thread going through a node
+ * adds a virtual loss to it, so the other threads explore different branches
+ * until the playout result is backed up. Node statistics are atomics and a
+ * node is expanded by the first thread claiming it, the tree is lock-free.
+ *
+ * The tree is kept after a search. When the next search starts from a
+ * position found one or two moves below the previous root, that subtree
+ * becomes the new root with its statistics.
+ */
+class MctsSearch {
+public:
+    /**
+     * @brief Outcome of a search.
+     */
+    struct Result {
+        int point = -1;           ///< Most visited move (GoBoard point), -1 if no legal move.
+        QVector<int> ranked;      ///< Root moves, most visited first.
+        double winRate = 0.0;     ///< Win rate of the best move for the searching player.
+        quint64 playouts = 0;     ///< Playouts run by this search.
+        quint64 reused = 0;       ///< Playouts inherited from the previous search.
+        qint64 elapsedMs = 0;     ///< Time spent searching.
+        int threads = 0;          ///< Worker threads used.
+
+        /**
+         * @brief Playouts per second, the throughput metric of the bot.
+         */
+        double playoutsPerSecond() const { return elapsedMs > 0 ? playouts * 1000.0 / elapsedMs : 0.0; }
+    };
+
+    MctsSearch() : threadCount_(qMax(1u, std::thread::hardware_concurrency())) {}
+
+    void setTimeBudget(int milliseconds) { timeBudgetMs_ = milliseconds; }
+    int timeBudget() const { return timeBudgetMs_; }
+
+    /**
+     * @brief Sets the number of playouts after which the search stops (0 for no limit).
+     */
+    void setMaxPlayouts(quint64 playouts) { maxPlayouts_ = playouts; }
+    quint64 maxPlayouts() const { return maxPlayouts_; }
+
+    void setThreadCount(int threads) { threadCount_ = qMax(1, threads); }
+    int threadCount() const { return threadCount_; }
+
+    /**
+     * @brief Sets the points given to Player2 (white) for playing second.
+     */
+    void setKomi(double komi) { komi_ = komi; }
+    double komi() const { return komi_; }
+
+    /**
+     * @brief Limits the memory of the tree; leaves are no longer expanded past this count.
+     */
+    void setMaxNodes(int nodes) { maxNodes_ = nodes; }
+
+    /**
+     * @brief Drops the tree kept from the previous search.
+     */
+    void clear() {
+        root_.reset();
+        nodeCount_ = 0;
+    }
+
+    /**
+     * @brief Sets a flag that stops the search when raised from another thread.
+     * @param flag The flag to poll, or null.
+     */
+    void setStopFlag(const std::atomic<bool> *flag) { stopFlag_ = flag; }
+
+    /**
+     * @brief Searches the best move of a player.
+     * @param board The position to search from.
+     * @param player The player to move.
+     * @param history Hashes of the positions already played (positional superko).
+     * @return The statistics of the search and the root moves ranked by visits.
+     */
+    Result search(const GoBoard &board, PlayerEnums::PlayerPosition player, const QSet<quint64> &history = QSet<quint64>()) {
+        QElapsedTimer timer;
+        timer.start();
+
+        Result result;
+        reuseTree(board, player);
+        rootBoard_ = board;
+        history_ = history;
+        playouts_ = 0;
+        result.reused = root_->visits.load();
+
+        // Expands the root up front so that a position without legal move is seen at once
+        std::vector<quint64> path;
+        if (root_->state.load(std::memory_order_acquire) == Node::Leaf) {
+            int expected = Node::Leaf;
+            if (root_->state.compare_exchange_strong(expected, Node::Expanding)) {
+                Random random(0x9E3779B97F4A7C15ULL);
+                expand(root_.get(), rootBoard_, path, random);
+            }
+        }
+
+        if (!root_->children.empty()) {
+            std::vector<std::thread> workers;
+            for (int i = 1; i < threadCount_; ++i) {
+                workers.emplace_back([this, &timer, i]() { work(timer, i); });
+            }
+            work(timer, 0);
+            for (std::thread &worker : workers) {
+                worker.join();
+            }
+        }
+
+        std::vector<const Node *> children;
+        for (const std::unique_ptr<Node> &child : root_->children) {
+            children.push_back(child.get());
+        }
+        std::stable_sort(children.begin(), children.end(), [](const Node *a, const Node *b) {
+            return a->visits.load() > b->visits.load();
+        });
+        for (const Node *child : children) {
+            result.ranked.append(child->move);
+        }
+        if (!children.empty()) {
+            result.point = children.front()->move;
+            const int visits = children.front()->visits.load();
+            result.winRate = visits > 0 ? double(children.front()->wins.load()) / visits : 0.0;
+        }
+
+        result.playouts = playouts_.load();
+        result.elapsedMs = timer.elapsed();
+        result.threads = threadCount_;
+        return result;
+    }
+
+private:
+    static constexpr int VirtualLoss = 3;        ///< Visits added (as losses) while a thread is below a node.
+    static constexpr int ExpandVisits = 2;       ///< Visits of a leaf before it gets children.
+    static constexpr double Exploration = 0.7;   ///< UCT exploration constant.
+
+    struct Node {
+        enum { Leaf, Expanding, Expanded };
+
+        Node(Node *parent, int move, PlayerEnums::PlayerPosition player) : parent(parent), move(move), player(player) {}
+
+        Node *parent;                             ///< Parent node, null for the root.
+        int move;                                 ///< Point played to reach the node (-1 for the root).
+        PlayerEnums::PlayerPosition player;       ///< Player who played the move.
+        std::atomic<int> visits{ 0 };             ///< Visits, virtual losses included.
+        std::atomic<int> wins{ 0 };               ///< Playouts won by player.
+        std::atomic<int> state{ Leaf };           ///< Expansion state, children are readable once Expanded.
+        std::vector<std::unique_ptr<Node>> children;
+    };
+
+    // xorshift64*, one per worker thread
+    struct Random {
+        explicit Random(quint64 seed) : state(seed ? seed : 1) {}
+        quint64 next() {
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            return state * 0x2545F4914F6CDD1DULL;
+        }
+        int bounded(int n) { return int(((next() >> 32) * quint64(n)) >> 32); }
+        quint64 state;
+    };
+
+    static PlayerEnums::PlayerPosition opponentOf(PlayerEnums::PlayerPosition player) {
+        return player == PlayerEnums::Player1 ? PlayerEnums::Player2 : PlayerEnums::Player1;
+    }
+
+    static PlayerEnums::PlayerPosition toPlayAt(const Node *node) { return opponentOf(node->player); }
+
+    void work(const QElapsedTimer &timer, int index) {
+        Random random(0x9E3779B97F4A7C15ULL * (index + 1) ^ quint64(timer.nsecsElapsed()));
+        std::vector<quint64> path;
+        std::vector<int> empties;
+        std::vector<int> emptyIndex;
+        QVector<int> captured;
+        while (!stopFlag_ || !stopFlag_->load(std::memory_order_relaxed)) {
+            if (timeBudgetMs_ > 0 && timer.elapsed() >= timeBudgetMs_) {
+                break;
+            }
+            if (maxPlayouts_ > 0 && playouts_.fetch_add(1) >= maxPlayouts_) {
+                break;
+            }
+            iterate(random, path, empties, emptyIndex, captured);
+            if (maxPlayouts_ == 0) {
+                playouts_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        if (maxPlayouts_ > 0) {
+            // The counter went one past the limit in every thread
+            quint64 count = playouts_.load();
+            while (count > maxPlayouts_ && !playouts_.compare_exchange_weak(count, maxPlayouts_)) {
+            }
+        }
+    }
+
+    void iterate(Random &random, std::vector<quint64> &path, std::vector<int> &empties, std::vector<int> &emptyIndex, QVector<int> &captured) {
+        GoBoard board = rootBoard_;
+        path.clear();
+
+        Node *node = root_.get();
+        node->visits.fetch_add(VirtualLoss, std::memory_order_relaxed);
+        for (;;) {
+            const int state = node->state.load(std::memory_order_acquire);
+            if (state == Node::Leaf && node->visits.load(std::memory_order_relaxed) >= ExpandVisits + VirtualLoss
+                && nodeCount_.load(std::memory_order_relaxed) < maxNodes_) {
+                int expected = Node::Leaf;
+                if (node->state.compare_exchange_strong(expected, Node::Expanding)) {
+                    expand(node, board, path, random);
+                    if (node->children.empty()) {
+                        break;
+                    }
+                    continue; // Goes down to one of the new children
+                }
+            }
+            if (state != Node::Expanded || node->children.empty()) {
+                break;
+            }
+
+            node = select(node);
+            node->visits.fetch_add(VirtualLoss, std::memory_order_relaxed);
+            board.play(node->move, node->player);
+            path.push_back(board.hash());
+        }
+
+        const PlayerEnums::PlayerPosition winner = playout(board, toPlayAt(node), random, empties, emptyIndex, captured);
+
+        for (; node; node = node->parent) {
+            node->visits.fetch_add(1 - VirtualLoss, std::memory_order_relaxed);
+            if (node->player == winner) {
+                node->wins.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    Node *select(Node *node) const {
+        const double logVisits = std::log(double(qMax(1, node->visits.load(std::memory_order_relaxed))));
+        Node *best = nullptr;
+        double bestScore = -1.0;
+        for (const std::unique_ptr<Node> &child : node->children) {
+            const int visits = child->visits.load(std::memory_order_relaxed);
+            if (visits == 0) {
+                return child.get(); // Children are shuffled, the first unvisited one is a random pick
+            }
+            const double score = double(child->wins.load(std::memory_order_relaxed)) / visits
+                + Exploration * std::sqrt(logVisits / visits);
+            if (score > bestScore) {
+                bestScore = score;
+                best = child.get();
+            }
+        }
+        return best;
+    }
+
+    // Called by the thread that switched the node to Expanding
+    void expand(Node *node, const GoBoard &board, const std::vector<quint64> &path, Random &random) {
+        const PlayerEnums::PlayerPosition player = toPlayAt(node);
+        for (int p = 0; p < board.pointCount(); ++p) {
+            if (!board.isLegal(p, player) || isOwnEye(board, p, player)) {
+                continue;
+            }
+            if (board.isHashed()) {
+                // Positional superko against the game and the moves above this node
+                GoBoard next = board;
+                next.play(p, player);
+                if (history_.contains(next.hash()) || std::find(path.begin(), path.end(), next.hash()) != path.end()) {
+                    continue;
+                }
+            }
+            node->children.push_back(std::make_unique<Node>(node, p, player));
+        }
+        for (int i = int(node->children.size()) - 1; i > 0; --i) {
+            std::swap(node->children[i], node->children[random.bounded(i + 1)]);
+        }
+        nodeCount_.fetch_add(int(node->children.size()), std::memory_order_relaxed);
+        node->state.store(Node::Expanded, std::memory_order_release);
+    }
+
+    // Plays random moves until both players pass, and returns the winner
+    PlayerEnums::PlayerPosition playout(GoBoard &board, PlayerEnums::PlayerPosition player, Random &random,
+                                        std::vector<int> &empties, std::vector<int> &emptyIndex, QVector<int> &captured) const {
+        empties.clear();
+        emptyIndex.assign(board.pointCount(), -1);
+        for (int p = 0; p < board.pointCount(); ++p) {
+            if (board.isEmpty(p)) {
+                emptyIndex[p] = int(empties.size());
+                empties.push_back(p);
+            }
+        }
+
+        const int maxMoves = 3 * board.rows() * board.cols();
+        int passes = 0;
+        for (int moves = 0; passes < 2 && moves < maxMoves; ++moves, player = opponentOf(player)) {
+            const int count = int(empties.size());
+            const int start = count > 0 ? random.bounded(count) : 0;
+            int chosen = -1;
+            for (int i = 0; i < count; ++i) {
+                const int p = empties[(start + i) % count];
+                if (board.isLegal(p, player) && !isOwnEye(board, p, player)) {
+                    chosen = p;
+                    break;
+                }
+            }
+            if (chosen < 0) {
+                ++passes;
+                continue;
+            }
+            passes = 0;
+
+            captured.clear();
+            board.play(chosen, player, &captured);
+            const int slot = emptyIndex[chosen];
+            empties[slot] = empties.back();
+            emptyIndex[empties[slot]] = slot;
+            empties.pop_back();
+            emptyIndex[chosen] = -1;
+            for (int stone : captured) {
+                emptyIndex[stone] = int(empties.size());
+                empties.push_back(stone);
+            }
+        }
+        return winnerOf(board);
+    }
+
+    // An empty point surrounded by the player's stones, with at most one enemy diagonal (none on the edge)
+    static bool isOwnEye(const GoBoard &board, int p, PlayerEnums::PlayerPosition player) {
+        for (int n : board.neighbors(p)) {
+            if (board.isOnBoard(n) && board.stoneAt(n) != player) {
+                return false;
+            }
+        }
+        const int stride = board.stride();
+        const int diagonals[4] = { p - stride - 1, p - stride + 1, p + stride - 1, p + stride + 1 };
+        int enemies = 0;
+        bool edge = false;
+        for (int d : diagonals) {
+            if (!board.isOnBoard(d)) {
+                edge = true;
+            } else if (board.stoneAt(d) == opponentOf(player)) {
+                ++enemies;
+            }
+        }
+        return enemies < (edge ? 1 : 2);
+    }
+
+    // Area scoring: stones plus empty points touching a single color, komi for Player2
+    PlayerEnums::PlayerPosition winnerOf(const GoBoard &board) const {
+        double score = -komi_;
+        for (int p = 0; p < board.pointCount(); ++p) {
+            if (!board.isOnBoard(p)) {
+                continue;
+            }
+            PlayerEnums::PlayerPosition owner = board.stoneAt(p);
+            if (owner == PlayerEnums::Unknown) {
+                for (int n : board.neighbors(p)) {
+                    const PlayerEnums::PlayerPosition neighbor = board.stoneAt(n);
+                    if (neighbor == PlayerEnums::Unknown) {
+                        continue;
+                    }
+                    if (owner != PlayerEnums::Unknown && owner != neighbor) {
+                        owner = PlayerEnums::Unknown;
+                        break;
+                    }
+                    owner = neighbor;
+                }
+            }
+            if (owner == PlayerEnums::Player1) {
+                score += 1.0;
+            } else if (owner == PlayerEnums::Player2) {
+                score -= 1.0;
+            }
+        }
+        return score > 0 ? PlayerEnums::Player1 : PlayerEnums::Player2;
+    }
+
+    // Keeps the subtree of the new position if it is at most two moves below the old root
+    void reuseTree(const GoBoard &board, PlayerEnums::PlayerPosition player) {
+        const PlayerEnums::PlayerPosition previous = opponentOf(player);
+        Node *found = nullptr;
+        if (root_ && board.isHashed() && rootBoard_.rows() == board.rows() && rootBoard_.cols() == board.cols()) {
+            if (rootBoard_.hash() == board.hash() && root_->player == previous) {
+                found = root_.get();
+            }
+            for (const std::unique_ptr<Node> &child : root_->children) {
+                if (found) {
+                    break;
+                }
+                GoBoard next = rootBoard_;
+                next.play(child->move, child->player);
+                if (next.hash() == board.hash() && child->player == previous) {
+                    found = child.get();
+                    break;
+                }
+                if (child->state.load() != Node::Expanded) {
+                    continue;
+                }
+                for (const std::unique_ptr<Node> &grandChild : child->children) {
+                    GoBoard last = next;
+                    last.play(grandChild->move, grandChild->player);
+                    if (last.hash() == board.hash() && grandChild->player == previous) {
+                        found = grandChild.get();
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (!found) {
+            root_ = std::make_unique<Node>(nullptr, -1, previous);
+            nodeCount_ = 1;
+            return;
+        }
+        if (found == root_.get()) {
+            return;
+        }
+
+        std::vector<std::unique_ptr<Node>> &siblings = found->parent->children;
+        auto it = std::find_if(siblings.begin(), siblings.end(), [found](const std::unique_ptr<Node> &node) { return node.get() == found; });
+        std::unique_ptr<Node> subtree = std::move(*it);
+        subtree->parent = nullptr;
+        root_ = std::move(subtree); // Frees the rest of the old tree
+        nodeCount_ = countNodes(root_.get());
+    }
+
+    static int countNodes(const Node *node) {
+        int count = 1;
+        if (node->state.load() == Node::Expanded) {
+            for (const std::unique_ptr<Node> &child : node->children) {
+                count += countNodes(child.get());
+            }
+        }
+        return count;
+    }
+
+    int timeBudgetMs_ = 1000;              ///< Thinking time per move, 0 for no limit.
+    quint64 maxPlayouts_ = 0;              ///< Playout limit per move, 0 for no limit.
+    int threadCount_;                      ///< Worker threads sharing the tree.
+    double komi_ = 7.5;                    ///< Points given to Player2.
+    int maxNodes_ = 1000000;               ///< Node limit of the tree.
+
+    std::unique_ptr<Node> root_;           ///< Root of the tree, kept between searches.
+    GoBoard rootBoard_;                    ///< Position of the root.
+    QSet<quint64> history_;                ///< Positions already played in the game.
+    std::atomic<int> nodeCount_{ 0 };      ///< Nodes in the tree.
+    std::atomic<quint64> playouts_{ 0 };   ///< Playouts of the current search.
+    const std::atomic<bool> *stopFlag_ = nullptr; ///< Raised to end the search early.
+};
+
+#endif // MCTSSEARCH_H
@@ -0,0 +1,29 @@
+#ifndef RANDOMENGINE_H
+#define RANDOMENGINE_H
+
+#include "AbstractBot/AbstractBotEngine.h"
+#include <random>
+
+class RandomEngine : public AbstractBotEngine {
+public:
+    RandomEngine() : random_(std::random_device()()) {}
+
+    Move think(const AbstractStrategyRulesGame& rules,
+               const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState,
+               PlayerEnums::PlayerPosition player, const ThinkingToken& token) override {
+        Q_UNUSED(token) // Picking a random move is immediate
+
+        // Pick uniformly among the legal moves given by the rules
+        rules.legalMoves(gameState, player, moves_);
+        if (moves_.isEmpty()) {
+            return Move(); // No valid move found
+        }
+        return moves_.at(std::uniform_int_distribution<int>(0, moves_.size() - 1)(random_));
+    }
+
+private:
+    std::mt19937 random_;  ///< Random generator of this engine (bots think on their own thread).
+    QVector<Move> moves_;  ///< Legal moves buffer, reused between moves.
+};
+
+#endif // RANDOMENGINE_H
@@ -0,0 +1,92 @@
+#ifndef TRANSPOSITIONTABLE_H
+#define TRANSPOSITIONTABLE_H
+
+#include <QVector>
+#include <QtGlobal>
+
+/**
+ * @class TranspositionTable
+ * @brief Fixed-size hash table of search results, indexed by Zobrist key.
+ *
+ * The table never grows: it holds a power-of-two number of entries and a new
+ * result replaces the entry at its slot, unless that entry describes the same
+ * position searched deeper. Each entry keeps the full key, so an index
+ * collision is detected and reported as a miss.
+ */
+class TranspositionTable {
+public:
+    /**
+     * @brief Kind of bound stored with a score.
+     */
+    enum Bound : quint8 {
+        Exact, ///< The score is the exact value of the position.
+        Lower, ///< The search failed high: the value is at least the score.
+        Upper  ///< The search failed low: the value is at most the score.
+    };
+
+    /**
+     * @brief One stored search result.
+     */
+    struct Entry {
+        quint64 key = 0;       ///< Zobrist key of the position (0 for an empty slot).
+        qint32 score = 0;      ///< Score from the side to move point of view.
+        qint16 bestFrom = -1;  ///< Cell index (row * cols + col) the best move starts from, -1 if none.
+        qint16 bestTo = -1;    ///< Cell index the best move lands on.
+        qint8 depth = -1;      ///< Remaining depth of the search that produced the score.
+        Bound bound = Exact;   ///< Meaning of the score.
+    };
+
+    /**
+     * @brief Creates a table.
+     * @param sizeInMegabytes Approximate memory used by the table.
+     */
+    explicit TranspositionTable(int sizeInMegabytes = 16) { resize(sizeInMegabytes); }
+
+    /**
+     * @brief Reallocates the table, dropping every entry.
+     */
+    void resize(int sizeInMegabytes) {
+        const quint64 wanted = quint64(qMax(1, sizeInMegabytes)) * 1024 * 1024 / sizeof(Entry);
+        quint64 count = 1;
+        while (count * 2 <= wanted) {
+            count *= 2;
+        }
+        entries_ = QVector<Entry>(int(count));
+        mask_ = count - 1;
+    }
+
+    void clear() { entries_.fill(Entry()); }
+
+    int capacity() const { return entries_.size(); }
+
+    /**
+     * @brief Looks a position up.
+     * @return The entry of the position, or nullptr if it is not stored.
+     */
+    const Entry *probe(quint64 key) const {
+        const Entry &entry = entries_[int(key & mask_)];
+        return entry.key == key ? &entry : nullptr;
+    }
+
+    /**
+     * @brief Stores a search result.
+     */
+    void store(quint64 key, int depth, int score, Bound bound, int bestFrom, int bestTo) {
+        Entry &entry = entries_[int(key & mask_)];
+        if (entry.key == key && entry.depth > depth) {
+            return; // Keep the deeper result of the same position
+        }
+        entry.key = key;
+        entry.score = score;
+        entry.depth = qint8(depth);
+        entry.bound = bound;
+        entry.bestFrom = qint16(bestFrom);
+        entry.bestTo = qint16(bestTo);
+    }
+
+private:
+    QVector<Entry> entries_; ///< Power-of-two sized slot array.
+    quint64 mask_ = 0;       ///< entries_.size() - 1.
+};
+
+#endif // TRANSPOSITIONTABLE_H
@@ -0,0 +1,54 @@
+#ifndef BOARDEVALUATOR_H
+#define BOARDEVALUATOR_H
+
+#include "games/AbstractGame/AbstractStrategyRulesGame.h"
+
+/**
+ * @class BoardEvaluator
+ * @brief Static evaluation of a position, plugged into search bots per game.
+ *
+ * Scores are centipawn-like integers from the point of view of one player:
+ * positive when the position is good for that player. They must stay well
+ * below BoardEvaluator::WinScore, which is reserved for decided games.
+ */
+class BoardEvaluator {
+public:
+    static constexpr int WinScore = 1000000; ///< Score of a won game.
+
+    virtual ~BoardEvaluator() {}
+
+    /**
+     * @brief Evaluates a position.
+     * @param state The position to evaluate.
+     * @param player The player whose point of view is used.
+     * @return The score of the position for `player`.
+     */
+    virtual int evaluate(const AbstractStrategyRulesGame::State &state, PlayerEnums::PlayerPosition player) const = 0;
+
+protected:
+    static PlayerEnums::PlayerPosition opponentOf(PlayerEnums::PlayerPosition player) {
+        return player == PlayerEnums::Player1 ? PlayerEnums::Player2 : PlayerEnums::Player1;
+    }
+};
+
+/**
+ * @class MaterialEvaluator
+ * @brief Fallback evaluator counting the pieces of each player.
+ */
+class MaterialEvaluator : public BoardEvaluator {
+public:
+    int evaluate(const AbstractStrategyRulesGame::State &state, PlayerEnums::PlayerPosition player) const override {
+        int score = 0;
+        const AbstractStrategyRulesGame::AtomicCellState *cells = state.data();
+        for (int i = 0; i < state.size(); ++i) {
+            if (cells[i].position == player) {
+                ++score;
+            } else if (cells[i].position != PlayerEnums::Unknown) {
+                --score;
+            }
+        }
+        return score;
+    }
+};
+
+#endif // BOARDEVALUATOR_H
@@ -0,0 +1,41 @@
+#ifndef CHECKERSEVALUATOR_H
+#define CHECKERSEVALUATOR_H
+
+#include "BoardEvaluator.h"
+
+/**
+ * @class CheckersEvaluator
+ * @brief Material and advancement evaluation for checkers.
+ *
+ * A man is worth 100 plus a small bonus per row advanced toward promotion,
+ * a king is worth 175.
+ */
+class CheckersEvaluator : public BoardEvaluator {
+public:
+    static constexpr int ManValue = 100;
+    static constexpr int KingValue = 175;
+    static constexpr int AdvanceBonus = 4;
+
+    int evaluate(const AbstractStrategyRulesGame::State &state, PlayerEnums::PlayerPosition player) const override {
+        int score = 0;
+        for (int row = 0; row < state.rows(); ++row) {
+            for (int col = 0; col < state.cols(); ++col) {
+                const AbstractStrategyRulesGame::AtomicCellState cell = state.at(row, col);
+                if (cell.position == PlayerEnums::Unknown) {
+                    continue;
+                }
+
+                int value = KingValue;
+                if (cell.typeId != 2) {
+                    // Player1 moves toward the last row, Player2 toward row 0
+                    const int advance = cell.position == PlayerEnums::Player1 ? row : state.rows() - 1 - row;
+                    value = ManValue + AdvanceBonus * advance;
+                }
+                score += cell.position == player ? value : -value;
+            }
+        }
+        return score;
+    }
+};
+
+#endif // CHECKERSEVALUATOR_H
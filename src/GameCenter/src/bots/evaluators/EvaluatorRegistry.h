@@ -0,0 +1,72 @@
+#ifndef EVALUATORREGISTRY_H
+#define EVALUATORREGISTRY_H
+
+#include <QHash>
+#include <QString>
+#include <functional>
+#include <memory>
+#include "BoardEvaluator.h"
+#include "CheckersEvaluator.h"
+#include "GoEvaluator.h"
+#include "KInARowEvaluator.h"
+#include "games/TicTacToeRules.h"
+
+/**
+ * @class EvaluatorRegistry
+ * @brief Maps a game name (AbstractStrategyRulesGame::gameName()) to its evaluator.
+ *
+ * Built-in evaluators are registered for the bundled games; new games plug
+ * their own with registerEvaluator(). Unknown games get a MaterialEvaluator.
+ */
+class EvaluatorRegistry {
+public:
+    using Factory = std::function<std::unique_ptr<BoardEvaluator>(const AbstractStrategyRulesGame *rules)>;
+
+    /**
+     * @brief Registers (or replaces) the evaluator of a game.
+     * @param gameName The name returned by the rules of the game.
+     * @param factory Creates an evaluator for a rules instance.
+     */
+    static void registerEvaluator(const QString &gameName, Factory factory) {
+        factories().insert(gameName, std::move(factory));
+    }
+
+    /**
+     * @brief Creates the evaluator of a game.
+     * @param rules The rules of the game to evaluate.
+     * @return The registered evaluator, or a MaterialEvaluator for unknown games.
+     */
+    static std::unique_ptr<BoardEvaluator> create(const AbstractStrategyRulesGame *rules) {
+        const Factory factory = factories().value(rules->gameName());
+        if (factory) {
+            if (std::unique_ptr<BoardEvaluator> evaluator = factory(rules)) {
+                return evaluator;
+            }
+        }
+        return std::make_unique<MaterialEvaluator>();
+    }
+
+private:
+    static QHash<QString, Factory> &factories() {
+        static QHash<QString, Factory> registry = builtIns();
+        return registry;
+    }
+
+    static QHash<QString, Factory> builtIns() {
+        const Factory kInARow = [](const AbstractStrategyRulesGame *rules) -> std::unique_ptr<BoardEvaluator> {
+            if (const auto *ticTacToe = dynamic_cast<const TicTacToeRules *>(rules)) {
+                return std::make_unique<KInARowEvaluator>(ticTacToe->lines());
+            }
+            return nullptr;
+        };
+
+        QHash<QString, Factory> registry;
+        registry.insert(QStringLiteral("Checkers"), [](const AbstractStrategyRulesGame *) { return std::make_unique<CheckersEvaluator>(); });
+        registry.insert(QStringLiteral("Go"), [](const AbstractStrategyRulesGame *) { return std::make_unique<GoEvaluator>(); });
+        registry.insert(QStringLiteral("TicTacToe"), kInARow);
+        registry.insert(QStringLiteral("Gomoku"), kInARow);
+        return registry;
+    }
+};
+
+#endif // EVALUATORREGISTRY_H
@@ -0,0 +1,48 @@
+#ifndef GOEVALUATOR_H
+#define GOEVALUATOR_H
+
+#include "BoardEvaluator.h"
+
+/**
+ * @class GoEvaluator
+ * @brief Rough area count for Go.
+ *
+ * Counts the stones of each player, plus the empty points whose neighbors
+ * all belong to the same player. Good enough to order moves and compare
+ * shallow positions; the MCTS bot is the intended Go player.
+ */
+class GoEvaluator : public BoardEvaluator {
+public:
+    int evaluate(const AbstractStrategyRulesGame::State &state, PlayerEnums::PlayerPosition player) const override {
+        static const int directions[4][2] = { {0, -1}, {0, 1}, {-1, 0}, {1, 0} };
+
+        int score = 0;
+        for (int row = 0; row < state.rows(); ++row) {
+            for (int col = 0; col < state.cols(); ++col) {
+                PlayerEnums::PlayerPosition owner = state.at(row, col).position;
+                if (owner == PlayerEnums::Unknown) {
+                    // An empty point belongs to a player if it only touches his stones
+                    for (const auto &direction : directions) {
+                        const int neighborRow = row + direction[0];
+                        const int neighborCol = col + direction[1];
+                        if (!state.isValid(neighborRow, neighborCol)) {
+                            continue;
+                        }
+                        const PlayerEnums::PlayerPosition neighbor = state.at(neighborRow, neighborCol).position;
+                        if (neighbor == PlayerEnums::Unknown || (owner != PlayerEnums::Unknown && neighbor != owner)) {
+                            owner = PlayerEnums::Unknown;
+                            break;
+                        }
+                        owner = neighbor;
+                    }
+                }
+                if (owner != PlayerEnums::Unknown) {
+                    score += owner == player ? 1 : -1;
+                }
+            }
+        }
+        return score;
+    }
+};
+
+#endif // GOEVALUATOR_H
@@ -0,0 +1,54 @@
+#ifndef KINAROWEVALUATOR_H
+#define KINAROWEVALUATOR_H
+
+#include "BoardEvaluator.h"
+#include "games/KInARowBoard.h"
+
+/**
+ * @class KInARowEvaluator
+ * @brief Open-line evaluation for TicTacToe and Gomoku.
+ *
+ * Every winning line still open for a single player scores for that player,
+ * with a weight growing tenfold per stone already on the line. Lines holding
+ * stones of both players are dead and score nothing.
+ */
+class KInARowEvaluator : public BoardEvaluator {
+public:
+    explicit KInARowEvaluator(const KInARowLines &lines) : lines_(lines) {}
+
+    int evaluate(const AbstractStrategyRulesGame::State &state, PlayerEnums::PlayerPosition player) const override {
+        if (!lines_.matches(state)) {
+            return 0;
+        }
+
+        KInARowMask player1;
+        KInARowMask player2;
+        KInARowLines::split(state, player1, player2);
+
+        int score = 0;
+        for (int i = 0; i < lines_.lineCount(); ++i) {
+            const KInARowMask &line = lines_.line(i);
+            const int mine1 = player1.countIn(line);
+            const int mine2 = player2.countIn(line);
+            if (mine1 > 0 && mine2 == 0) {
+                score += weight(mine1);
+            } else if (mine2 > 0 && mine1 == 0) {
+                score -= weight(mine2);
+            }
+        }
+        return player == PlayerEnums::Player1 ? score : -score;
+    }
+
+private:
+    static int weight(int stones) {
+        int value = 1;
+        for (int i = 1; i < qMin(stones, 6); ++i) {
+            value *= 10;
+        }
+        return value;
+    }
+
+    KInARowLines lines_; ///< Winning lines of the evaluated board.
+};
+
+#endif // KINAROWEVALUATOR_H
@@ -35,6 +35,13 @@ public:
      */
     T next();
 
+    /**
+     * @brief Moves to the previous element in the list in a circular manner.
+     * @return The previous element.
+     * @throws std::out_of_range If the list is empty.
+     */
+    T previous();
+
     /**
      * @brief Returns the current element without changing the current index.
      * @return The current element.
@@ -83,6 +90,11 @@ public:
      */
     void clear();
 
+    /**
+     * @brief Makes the first element the current one again.
+     */
+    void rewind();
+
     /**
      * @brief Returns the size of the list.
      * @return The number of elements in the list.
@@ -18,6 +18,13 @@ T QCircularList<T>::next() {
     return list_.at(currentIndex_);
 }
 
+template <typename T>
+T QCircularList<T>::previous() {
+    ensureNotEmpty();
+    currentIndex_ = (currentIndex_ - 1 + list_.size()) % list_.size();
+    return list_.at(currentIndex_);
+}
+
 template <typename T>
 T QCircularList<T>::current() const {
     ensureNotEmpty();
@@ -72,6 +79,11 @@ void QCircularList<T>::clear() {
     currentIndex_ = -1;
 }
 
+template <typename T>
+void QCircularList<T>::rewind() {
+    currentIndex_ = list_.isEmpty() ? -1 : 0;
+}
+
 template <typename T>
 int QCircularList<T>::size() const {
     return list_.size();
@@ -4,10 +4,88 @@
 #include <QVector>
 #include <stdexcept>
 #include <QSize>
+#include <type_traits>
 
 /**
- * @brief A generic matrix class implemented using `QVector`.
+ * @brief A lightweight view over a strided sequence of matrix elements.
  *
+ * A slice does not own its elements: it points into the storage of a QMatrix
+ * and stays valid as long as the matrix is neither resized nor destroyed.
+ * Rows are contiguous (stride 1), columns are strided by the number of columns.
+ *
+ * @tparam T The element type, `const`-qualified for read-only views.
+ */
+template<typename T>
+class QMatrixSlice {
+public:
+    /**
+     * @brief Constructs a slice.
+     *
+     * @param data Pointer to the first element of the slice.
+     * @param size Number of elements in the slice.
+     * @param stride Distance, in elements, between two consecutive elements.
+     */
+    QMatrixSlice(T* data, int size, int stride = 1) : data_(data), size_(size), stride_(stride) {}
+
+    /**
+     * @brief Access an element of the slice without bounds checking.
+     *
+     * @param index The index of the element in the slice.
+     * @return A reference to the element.
+     */
+    T& operator[](int index) const { return data_[index * stride_]; }
+
+    /**
+     * @brief Access an element of the slice.
+     *
+     * @param index The index of the element in the slice.
+     * @return A reference to the element.
+     * @throws std::out_of_range If the index is invalid.
+     */
+    T& at(int index) const {
+        if (index < 0 || index >= size_) {
+            throw std::out_of_range("Slice index out of range");
+        }
+        return data_[index * stride_];
+    }
+
+    /**
+     * @brief Get the number of elements in the slice.
+     *
+     * @return The number of elements.
+     */
+    int size() const { return size_; }
+
+    /**
+     * @brief Copy the slice into a QVector.
+     *
+     * @return A QVector holding a copy of the elements.
+     */
+    QVector<std::remove_const_t<T>> toVector() const {
+        QVector<std::remove_const_t<T>> result;
+        result.reserve(size_);
+        for (int i = 0; i < size_; ++i) {
+            result.append(data_[i * stride_]);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Implicit conversion to QVector, kept for callers of the former copying API.
+     */
+    operator QVector<std::remove_const_t<T>>() const { return toVector(); }
+
+private:
+    T* data_;    ///< First element of the slice.
+    int size_;   ///< Number of elements in the slice.
+    int stride_; ///< Distance between two consecutive elements.
+};
+
+/**
+ * @brief A generic matrix class implemented on a single contiguous `QVector`.
+ *
+ * Elements are stored row-major in one buffer, so copying a matrix costs a
+ * single allocation and element access is a multiply-add on the row stride.
  * This class provides various operations and utilities for matrix manipulation,
  * including resizing, element access, and mathematical operations like addition,
  * subtraction, and multiplication.
@@ -17,6 +95,9 @@
 template<typename T>
 class QMatrix {
 public:
+    using RowView = QMatrixSlice<T>;               ///< Read/write view over a row or a column.
+    using ConstRowView = QMatrixSlice<const T>;    ///< Read-only view over a row or a column.
+
     /**
      * @brief Default constructor for the matrix.
      *
@@ -58,19 +139,42 @@ public:
      * @brief Get a specific row from the matrix.
      *
      * @param row The index of the row to retrieve.
-     * @return A QVector representing the row.
+     * @return A read-only view over the row (converts to QVector if a copy is needed).
      * @throws std::out_of_range If the specified row index is invalid.
      */
-    QVector<T> getRow(int row) const;
+    ConstRowView getRow(int row) const;
 
     /**
      * @brief Get a specific column from the matrix.
      *
      * @param col The index of the column to retrieve.
-     * @return A QVector representing the column.
+     * @return A read-only strided view over the column (converts to QVector if a copy is needed).
      * @throws std::out_of_range If the specified column index is invalid.
      */
-    QVector<T> getColumn(int col) const;
+    ConstRowView getColumn(int col) const;
+
+    /**
+     * @brief Access the underlying row-major storage (read/write).
+     *
+     * The element at (row, col) lives at `data()[row * cols() + col]`.
+     *
+     * @return A pointer to the first element, valid for size() elements.
+     */
+    T* data();
+
+    /**
+     * @brief Access the underlying row-major storage (read-only).
+     *
+     * @return A pointer to the first element, valid for size() elements.
+     */
+    const T* data() const;
+
+    /**
+     * @brief Get the total number of elements in the matrix.
+     *
+     * @return rows() * cols().
+     */
+    int size() const;
 
     /**
      * @brief Resize the matrix to new dimensions.
@@ -133,19 +237,19 @@ public:
      * @brief Access a row of the matrix using the index operator (read/write).
      *
      * @param row The index of the row to access.
-     * @return A reference to the QVector representing the row.
+     * @return A view over the row, indexable by column.
      * @throws std::out_of_range If the specified row index is invalid.
      */
-    QVector<T>& operator[](int row);
+    RowView operator[](int row);
 
     /**
      * @brief Access a row of the matrix using the index operator (read-only).
      *
      * @param row The index of the row to access.
-     * @return A reference to the QVector representing the row.
+     * @return A read-only view over the row, indexable by column.
      * @throws std::out_of_range If the specified row index is invalid.
      */
-    const QVector<T>& operator[](int row) const;
+    ConstRowView operator[](int row) const;
 
     /**
      * @brief Compare two matrices for equality.
@@ -194,7 +298,7 @@ public:
 private:
     int rows_;                    ///< Number of rows in the matrix.
     int cols_;                    ///< Number of columns in the matrix.
-    QVector<QVector<T>> data_;    ///< Data storage for the matrix.
+    QVector<T> data_;             ///< Row-major data storage for the matrix.
 
     /**
      * @brief Ensure that a given index is valid within the matrix.
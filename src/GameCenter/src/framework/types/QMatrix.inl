@@ -2,7 +2,7 @@
 
 template<typename T>
 QMatrix<T>::QMatrix(int rows, int cols, const T& defaultValue)
-    : rows_(rows), cols_(cols), data_(rows, QVector<T>(cols, defaultValue)) {}
+    : rows_(rows), cols_(cols), data_(rows * cols, defaultValue) {}
 
 template<typename T>
 QMatrix<T>::QMatrix(const QSize& size, const T& defaultValue)
@@ -11,33 +11,44 @@ QMatrix<T>::QMatrix(const QSize& size, const T& defaultValue)
 template<typename T>
 const T& QMatrix<T>::at(int row, int col) const {
     ensureIndexIsValid(row, col);
-    return data_[row][col];
+    return data_[row * cols_ + col];
 }
 
 template<typename T>
 T& QMatrix<T>::at(int row, int col) {
     ensureIndexIsValid(row, col);
-    return data_[row][col];
+    return data_[row * cols_ + col];
 }
 
 template<typename T>
-QVector<T> QMatrix<T>::getRow(int row) const {
+typename QMatrix<T>::ConstRowView QMatrix<T>::getRow(int row) const {
     if (row < 0 || row >= rows_) {
         throw std::out_of_range("Invalid row index");
     }
-    return data_[row];
+    return ConstRowView(data_.constData() + row * cols_, cols_);
 }
 
 template<typename T>
-QVector<T> QMatrix<T>::getColumn(int col) const {
+typename QMatrix<T>::ConstRowView QMatrix<T>::getColumn(int col) const {
     if (col < 0 || col >= cols_) {
         throw std::out_of_range("Invalid column index");
     }
-    QVector<T> column(rows_);
-    for (int row = 0; row < rows_; ++row) {
-        column[row] = data_[row][col];
-    }
-    return column;
+    return ConstRowView(data_.constData() + col, rows_, cols_);
+}
+
+template<typename T>
+T* QMatrix<T>::data() {
+    return data_.data();
+}
+
+template<typename T>
+const T* QMatrix<T>::data() const {
+    return data_.constData();
+}
+
+template<typename T>
+int QMatrix<T>::size() const {
+    return rows_ * cols_;
 }
 
 template<typename T>
@@ -51,19 +62,19 @@ T& QMatrix<T>::operator()(int row, int col) {
 }
 
 template<typename T>
-QVector<T>& QMatrix<T>::operator[](int row) {
+typename QMatrix<T>::RowView QMatrix<T>::operator[](int row) {
     if (row < 0 || row >= rows_) {
         throw std::out_of_range("Row index out of range");
     }
-    return data_[row];
+    return RowView(data_.data() + row * cols_, cols_);
 }
 
 template<typename T>
-const QVector<T>& QMatrix<T>::operator[](int row) const {
+typename QMatrix<T>::ConstRowView QMatrix<T>::operator[](int row) const {
     if (row < 0 || row >= rows_) {
         throw std::out_of_range("Row index out of range");
     }
-    return data_[row];
+    return ConstRowView(data_.constData() + row * cols_, cols_);
 }
 
 template<typename T>
@@ -77,10 +88,11 @@ QMatrix<T> QMatrix<T>::operator+(const QMatrix<T>& other) const {
         throw std::invalid_argument("Matrix dimensions must match for addition");
     }
     QMatrix<T> result(rows_, cols_);
-    for (int row = 0; row < rows_; ++row) {
-        for (int col = 0; col < cols_; ++col) {
-            result.at(row, col) = this->at(row, col) + other.at(row, col);
-        }
+    const T* lhs = data_.constData();
+    const T* rhs = other.data_.constData();
+    T* out = result.data_.data();
+    for (int i = 0; i < data_.size(); ++i) {
+        out[i] = lhs[i] + rhs[i];
     }
     return result;
 }
@@ -91,10 +103,11 @@ QMatrix<T> QMatrix<T>::operator-(const QMatrix<T>& other) const {
         throw std::invalid_argument("Matrix dimensions must match for subtraction");
     }
     QMatrix<T> result(rows_, cols_);
-    for (int row = 0; row < rows_; ++row) {
-        for (int col = 0; col < cols_; ++col) {
-            result.at(row, col) = this->at(row, col) - other.at(row, col);
-        }
+    const T* lhs = data_.constData();
+    const T* rhs = other.data_.constData();
+    T* out = result.data_.data();
+    for (int i = 0; i < data_.size(); ++i) {
+        out[i] = lhs[i] - rhs[i];
     }
     return result;
 }
@@ -104,14 +117,19 @@ QMatrix<T> QMatrix<T>::operator*(const QMatrix<T>& other) const {
     if (cols_ != other.rows_) {
         throw std::invalid_argument("Matrix dimensions must be compatible for multiplication");
     }
+    // i-k-j loop order: both the left row and the right row are walked contiguously.
     QMatrix<T> result(rows_, other.cols_);
+    const T* lhs = data_.constData();
+    const T* rhs = other.data_.constData();
+    T* out = result.data_.data();
     for (int row = 0; row < rows_; ++row) {
-        for (int col = 0; col < other.cols_; ++col) {
-            T sum = T();
-            for (int k = 0; k < cols_; ++k) {
-                sum += this->at(row, k) * other.at(k, col);
+        T* outRow = out + row * other.cols_;
+        for (int k = 0; k < cols_; ++k) {
+            const T factor = lhs[row * cols_ + k];
+            const T* rhsRow = rhs + k * other.cols_;
+            for (int col = 0; col < other.cols_; ++col) {
+                outRow[col] += factor * rhsRow[col];
             }
-            result.at(row, col) = sum;
         }
     }
     return result;
@@ -123,9 +141,11 @@ QVector<T> QMatrix<T>::operator*(const QVector<T>& vec) const {
         throw std::invalid_argument("Vector size must match the number of columns in the matrix");
     }
     QVector<T> result(rows_, T());
+    const T* lhs = data_.constData();
     for (int row = 0; row < rows_; ++row) {
+        const T* lhsRow = lhs + row * cols_;
         for (int col = 0; col < cols_; ++col) {
-            result[row] += this->at(row, col) * vec[col];
+            result[row] += lhsRow[col] * vec[col];
         }
     }
     return result;
@@ -133,20 +153,14 @@ QVector<T> QMatrix<T>::operator*(const QVector<T>& vec) const {
 
 template<typename T>
 void QMatrix<T>::resize(int rows, int cols, const T& defaultValue) {
-    data_.resize(rows);
-    for (auto& row : data_) {
-        row.resize(cols);
-        std::fill(row.begin(), row.end(), defaultValue);
-    }
+    data_.fill(defaultValue, rows * cols);
     rows_ = rows;
     cols_ = cols;
 }
 
 template<typename T>
 void QMatrix<T>::clear(const T& defaultValue) {
-    for (auto& row : data_) {
-        std::fill(row.begin(), row.end(), defaultValue);
-    }
+    data_.fill(defaultValue);
 }
 
 template<typename T>
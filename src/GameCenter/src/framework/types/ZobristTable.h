@@ -0,0 +1,65 @@
+#ifndef ZOBRISTTABLE_H
+#define ZOBRISTTABLE_H
+
+#include <QtGlobal>
+#include <array>
+
+/**
+ * @brief Compile-time table of Zobrist keys.
+ *
+ * Each (cell, piece) pair gets a random 64-bit key. The hash of a position is
+ * the XOR of the keys of its occupied cells, so placing or removing a piece
+ * updates the hash with a single XOR, and the same 64-bit value can index a
+ * transposition table.
+ *
+ * Keys are generated with splitmix64 from a fixed seed: hashes are stable
+ * from one run to the next.
+ *
+ * @tparam Cells Number of cells covered by the table.
+ * @tparam Pieces Number of distinct piece kinds per cell.
+ */
+template<int Cells, int Pieces>
+class ZobristTable {
+    static_assert(Cells > 0 && Pieces > 0, "ZobristTable dimensions must be positive");
+
+public:
+    static constexpr int cells() { return Cells; }
+    static constexpr int pieces() { return Pieces; }
+
+    /**
+     * @brief Key of a piece kind standing on a cell.
+     */
+    static constexpr quint64 key(int cell, int piece) { return keys_[cell * Pieces + piece]; }
+
+    /**
+     * @brief Key to XOR in when the side to move must be part of the hash.
+     */
+    static constexpr quint64 sideToMove() { return sideKey_; }
+
+private:
+    static constexpr quint64 splitMix64(quint64 &state) {
+        quint64 z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    static constexpr std::array<quint64, Cells * Pieces> buildKeys() {
+        std::array<quint64, Cells * Pieces> keys {};
+        quint64 state = 0x5A0B1D2C3E4F6071ULL ^ (quint64(Cells) << 32) ^ quint64(Pieces);
+        for (int i = 0; i < Cells * Pieces; ++i) {
+            keys[i] = splitMix64(state);
+        }
+        return keys;
+    }
+
+    static constexpr quint64 buildSideKey() {
+        quint64 state = 0x0DDB1A5E5BAD5EEDULL;
+        return splitMix64(state);
+    }
+
+    static constexpr std::array<quint64, Cells * Pieces> keys_ = buildKeys(); ///< Key of every (cell, piece) pair.
+    static constexpr quint64 sideKey_ = buildSideKey();                       ///< Side to move key.
+};
+
+#endif // ZOBRISTTABLE_H
@@ -3,20 +3,48 @@
 
 #include "framework/types/QMatrix.h"
 #include "Player.h"
-
-class QAbstractGraphicsShapeItem;
+#include "Move.h"
+#include <memory>
 
 class AbstractStrategyRulesGame {
 
 public:
-    typedef struct {
-        PlayerEnums::PlayerPosition position;
-        int typeId;
-        QAbstractGraphicsShapeItem *item;
-    } AtomicCellState;
+    /**
+     * @brief Rule-only state of a board cell, packed in a single byte.
+     *
+     * Graphical items are not part of the rules state: AbstractTableGame keeps
+     * them in a parallel table, so rules and bots copy and compare plain bytes.
+     */
+    struct AtomicCellState {
+        PlayerEnums::PlayerPosition position : 4; ///< Owner of the cell (Unknown when empty).
+        quint8 typeId : 4;                         ///< Game specific piece type (0 when empty).
+
+        bool operator==(const AtomicCellState &other) const { return position == other.position && typeId == other.typeId; }
+        bool operator!=(const AtomicCellState &other) const { return !(*this == other); }
+    };
+
+    using State = QMatrix<AtomicCellState>;
+
+    /**
+     * @brief Incremental data a game keeps beside a state (Go chains, k-in-a-row stone masks).
+     *
+     * A tracker belongs to the owner of the state, a GameSession or a search,
+     * which passes it explicitly to the rules: apply() and unapply() keep it in
+     * step with the state, the const queries only read it. The rules object
+     * itself stays free of per-state data, so one instance can answer queries
+     * from several threads. Every method also accepts a null tracker and then
+     * works from the state alone.
+     */
+    class Tracker {
+    public:
+        virtual ~Tracker() {}
+    };
 
     virtual ~AbstractStrategyRulesGame() {}
 
+    // Copie indépendante des règles et de leur historique, pour réfléchir hors du thread de la scène
+    virtual std::unique_ptr<AbstractStrategyRulesGame> clone() const = 0;
+
     // Retourne le nom du jeu
     virtual QString gameName() const = 0;
 
@@ -32,14 +60,124 @@ public:
 
     virtual bool isDragEnable() const = 0;
 
-    // Vérifie si un mouvement est valide entre deux états
-    virtual bool isMoveValid(const QMatrix<AtomicCellState> &beforeState, QMatrix<AtomicCellState> &afterState, Player *player) = 0;
+    // Crée le suivi incrémental d'un état pour son propriétaire (nullptr si le jeu n'en a pas).
+    // reversible : les coups seront annulés dans l'ordre inverse (recherche), le suivi garde de quoi les reprendre
+    virtual std::unique_ptr<Tracker> track(const State &state, bool reversible = false) const {
+        Q_UNUSED(state) Q_UNUSED(reversible)
+        return nullptr;
+    }
+
+    // Vérifie un coup sur un état, sans modifier l'état
+    virtual bool validate(const State &state, const Move &move, const Tracker *tracker = nullptr) const = 0;
+
+    // Joue un coup validé sur l'état, en place ; complète move.captures et move.promotion
+    virtual void apply(State &state, Move &move, Tracker *tracker = nullptr) const = 0;
+
+    // Annule un coup joué par apply() : l'état redevient celui d'avant le coup
+    virtual void unapply(State &state, const Move &move, Tracker *tracker = nullptr) const = 0;
+
+    // Liste les coups légaux d'un joueur dans moves (vidé d'abord).
+    // Version générique par essais via validate() : chaque jeu la remplace par un générateur natif.
+    virtual void legalMoves(const State &state, PlayerEnums::PlayerPosition player, QVector<Move> &moves,
+                            const Tracker *tracker = nullptr) const {
+        moves.clear();
+        for (int row = 0; row < state.rows(); ++row) {
+            for (int col = 0; col < state.cols(); ++col) {
+                if (state.at(row, col).position != PlayerEnums::Unknown) {
+                    continue;
+                }
+                const QPoint to(col, row);
+                if (!isDragEnable()) {
+                    const Move move = Move::placement(to, player);
+                    if (validate(state, move, tracker)) {
+                        moves.append(move);
+                    }
+                    continue;
+                }
+                for (int fromRow = 0; fromRow < state.rows(); ++fromRow) {
+                    for (int fromCol = 0; fromCol < state.cols(); ++fromCol) {
+                        if (state.at(fromRow, fromCol).position == player) {
+                            const Move move(QPoint(fromCol, fromRow), to, player);
+                            if (validate(state, move, tracker)) {
+                                moves.append(move);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Ancienne API par différence d'états : retrouve le coup puis le joue sur afterState
+    virtual bool isMoveValid(const State &beforeState, State &afterState, Player *player) {
+        Move move;
+        if (!moveFromDiff(beforeState, afterState, player->playerPosition(), move) || !validate(beforeState, move)) {
+            return false;
+        }
+        afterState = beforeState;
+        apply(afterState, move);
+        return true;
+    }
 
     // Vérifie si un joueur a gagné dans l'état actuel
-    virtual PlayerEnums::PlayerPosition checkWin(const QMatrix<AtomicCellState> &gameState) const = 0;
+    virtual PlayerEnums::PlayerPosition checkWin(const QMatrix<AtomicCellState> &gameState, const Tracker *tracker = nullptr) const = 0;
 
     // Vérifie si le jeu est terminé
-    virtual bool isGameOver(const QMatrix<AtomicCellState> &gameState) const = 0;
+    virtual bool isGameOver(const QMatrix<AtomicCellState> &gameState, const Tracker *tracker = nullptr) const = 0;
+
+    // Début de partie : les règles qui gardent un historique des positions le réinitialisent
+    virtual void resetPositionHistory(const QMatrix<AtomicCellState> &initialState) { Q_UNUSED(initialState) }
+
+    // Un coup validé vient d'être joué : état devenu l'état courant de la partie
+    virtual void recordPosition(const QMatrix<AtomicCellState> &gameState, const Tracker *tracker = nullptr) {
+        Q_UNUSED(gameState) Q_UNUSED(tracker)
+    }
+
+    // Le coup qui a mené à cet état va être annulé : l'état quitte l'historique des positions
+    virtual void forgetPosition(const QMatrix<AtomicCellState> &gameState, const Tracker *tracker = nullptr) {
+        Q_UNUSED(gameState) Q_UNUSED(tracker)
+    }
+
+protected:
+    // Retrouve le coup d'un joueur entre deux états : une pose (une case) ou un déplacement (deux cases)
+    static bool moveFromDiff(const State &beforeState, const State &afterState, PlayerEnums::PlayerPosition player, Move &move) {
+        if (beforeState.rows() != afterState.rows() || beforeState.cols() != afterState.cols()) {
+            return false;
+        }
+
+        int changes = 0;
+        QPoint from(-1, -1);
+        QPoint to(-1, -1);
+        for (int row = 0; row < beforeState.rows(); ++row) {
+            for (int col = 0; col < beforeState.cols(); ++col) {
+                const PlayerEnums::PlayerPosition before = beforeState.at(row, col).position;
+                const PlayerEnums::PlayerPosition after = afterState.at(row, col).position;
+                if (before == after) {
+                    continue;
+                }
+                if (before == player && after == PlayerEnums::Unknown) {
+                    from = QPoint(col, row);
+                } else if (before == PlayerEnums::Unknown && after == player) {
+                    to = QPoint(col, row);
+                } else {
+                    return false;
+                }
+                ++changes;
+            }
+        }
+
+        const bool hasFrom = from != QPoint(-1, -1);
+        const bool hasTo = to != QPoint(-1, -1);
+        if (changes == 1 && hasTo) {
+            move = Move::placement(to, player);
+            return true;
+        }
+        if (changes == 2 && hasFrom && hasTo) {
+            move = Move(from, to, player);
+            return true;
+        }
+        return false;
+    }
 };
 
 #endif // ABSTRACTSTRATEGYRULESGAME_H
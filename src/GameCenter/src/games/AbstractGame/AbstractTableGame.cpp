@@ -2,10 +2,11 @@
 #include <QGraphicsSceneMouseEvent>
 #include <QGraphicsItem>
 #include <QCursor>
+#include <QtMath>
 
 AbstractTableGame::AbstractTableGame(QObject* parent)
     : QGraphicsScene(parent)
-    , rulesOfTheGame_(nullptr)
+    , legalMovesCached_(false)
     , draggedItem_(nullptr)
 {}
 
@@ -14,21 +15,31 @@ AbstractTableGame::AbstractTableGame(QObject* parent)
 // --------------------------------------------
 
 void AbstractTableGame::installRules(AbstractStrategyRulesGame* rules) {
-    rulesOfTheGame_ = rules;
+    session_.installRules(rules);
 }
 
 void AbstractTableGame::startGame() {
-    Q_ASSERT(rulesOfTheGame_);
+    Q_ASSERT(session_.rules());
 
     // Check for the minimum number of players
-    if (rulesOfTheGame_->numberMinPlayers() > players_.size()) {
-        emit missingPlayers(rulesOfTheGame_->numberMinPlayers() - players_.size());
+    if (session_.missingPlayers() > 0) {
+        emit missingPlayers(session_.missingPlayers());
         return;
     }
 
-    // Initialize game state
+    // Initialize the board, then the game state on the same grid
+    removePieceItems();
     initializeGame();
-    gameState_ = rulesOfTheGame_->initStatePlayers(cells_.rows(), cells_.cols());
+    indexCells();
+    session_.start(cells_.rows(), cells_.cols());
+    pieceItems_ = QMatrix<QAbstractGraphicsShapeItem*>(cells_.rows(), cells_.cols(), nullptr);
+    changedFlags_ = QMatrix<bool>(cells_.rows(), cells_.cols(), false);
+    changedCells_.clear();
+    legalMovesCached_ = false;
+
+    // Draw the starting pieces
+    markAllCellsChanged();
+    updateVisuals();
     setGameOpen(true);
 }
 
@@ -37,7 +48,7 @@ void AbstractTableGame::startGame() {
 // --------------------------------------------
 
 AbstractStrategyRulesGame *AbstractTableGame::rulesOfTheGame() const {
-    return rulesOfTheGame_;
+    return session_.rules();
 }
 
 
@@ -46,79 +57,186 @@ AbstractStrategyRulesGame *AbstractTableGame::rulesOfTheGame() const {
 // --------------------------------------------
 
 bool AbstractTableGame::playMove(Player *player, QPoint originalPosition, QPoint nextPosition) {
-    Q_ASSERT(rulesOfTheGame_);
+    Q_ASSERT(session_.rules());
 
-    // Validate positions
-    if (originalPosition.ry() < 0 || originalPosition.ry() >= gameState_.rows() ||
-        originalPosition.rx() < 0 || originalPosition.rx() >= gameState_.cols() ||
-        nextPosition.ry() < 0 || nextPosition.ry() >= gameState_.rows() ||
-        nextPosition.rx() < 0 || nextPosition.rx() >= gameState_.cols()) {
+    // The session validates the positions, the turn and the move against the rules
+    if (!session_.playMove(player, originalPosition, nextPosition)) {
         emit invalidMove(player);
         return false;
     }
 
-    if (player != players_.current()) {
-        emit invalidMove(player);
-        return false;
-    }
+    showPlayedMove(player);
+    return true;
+}
 
-    // Prepare the next game state
-    QMatrix<AbstractStrategyRulesGame::AtomicCellState> nextGameState_ = gameState_;
-    AbstractStrategyRulesGame::AtomicCellState oldCell = nextGameState_.at(originalPosition.ry(), originalPosition.rx());
-    nextGameState_.at(originalPosition.ry(), originalPosition.rx()) = { PlayerEnums::Unknown, 0, nullptr };
-    nextGameState_.at(nextPosition.ry(), nextPosition.rx()) = { player->playerPosition(), oldCell.typeId, oldCell.item };
+bool AbstractTableGame::playMove(Player *player, const Move &move) {
+    Q_ASSERT(session_.rules());
 
-    // Validate move against game rules
-    if (!rulesOfTheGame_->isMoveValid(gameState_, nextGameState_, player)) {
+    // The session validates the move against the rules, with the captures it carries
+    if (player != currentPlayer() || move.player != player->playerPosition() || !session_.play(move)) {
         emit invalidMove(player);
         return false;
     }
 
-    // Update game state
-    gameState_ = nextGameState_;
+    showPlayedMove(player);
+    return true;
+}
+
+void AbstractTableGame::showPlayedMove(Player *player) {
+    const Move &played = moveHistory().at(historyIndex() - 1);
+
+    // The graphical piece follows its cell, then only the cells changed by the move are redrawn
+    movePieceItem(played.from, played.to);
+    markMoveChanged(played);
+    legalMovesCached_ = false;
     updateVisuals();
-    players_.next();
 
-    emit playerMoved(player, nextPosition);
+    emit playerMoved(player, played.to);
 
     // Check for game over
-    PlayerEnums::PlayerPosition winner = rulesOfTheGame_->checkWin(gameState_);
-    bool isFinish = rulesOfTheGame_->isGameOver(gameState_);
-    setGameOpen(!isFinish);
-
+    setGameOpen(session_.isOpen());
     if (!gameOpen()) {
-        emit gameOver(winner);
+        emit gameOver(session_.winner());
     }
-
-    return true;
 }
 
 // --------------------------------------------
-// Player Management
+// Undo / Redo
 // --------------------------------------------
 
-bool AbstractTableGame::addPlayer(Player *player) {
-    Q_ASSERT(rulesOfTheGame_);
-    if (rulesOfTheGame_->numberMaxPlayers() <= players_.size()) {
+bool AbstractTableGame::undo() {
+    if (!canUndo()) {
         return false;
     }
 
-    if (players_.contains(player)) {
+    stepBack();
+    updateVisuals();
+    setGameOpen(session_.isOpen());
+    emit historyChanged();
+    return true;
+}
+
+bool AbstractTableGame::redo() {
+    if (!canRedo()) {
+        return false;
+    }
+
+    stepForward();
+    updateVisuals();
+    setGameOpen(session_.isOpen());
+    emit historyChanged();
+    return true;
+}
+
+bool AbstractTableGame::goToMove(int moveCount) {
+    if (moveCount < 0 || moveCount > moveHistory().size()) {
+        return false;
+    }
+    if (moveCount == historyIndex()) {
         return true;
     }
 
-    player->setPlayerPosition(static_cast<PlayerEnums::PlayerPosition>(players_.size()));
-    players_.append(player);
+    while (historyIndex() > moveCount) {
+        stepBack();
+    }
+    while (historyIndex() < moveCount) {
+        stepForward();
+    }
+
+    updateVisuals();
+    setGameOpen(session_.isOpen());
+    emit historyChanged();
     return true;
 }
 
+void AbstractTableGame::stepBack() {
+    const Move move = moveHistory().at(historyIndex() - 1);
+    session_.undo();
+    movePieceItem(move.to, move.from);
+    markMoveChanged(move);
+    legalMovesCached_ = false;
+}
+
+void AbstractTableGame::stepForward() {
+    session_.redo();
+    const Move &move = moveHistory().at(historyIndex() - 1);
+    movePieceItem(move.from, move.to);
+    markMoveChanged(move);
+    legalMovesCached_ = false;
+}
+
+void AbstractTableGame::movePieceItem(QPoint from, QPoint to) {
+    if (from != to) {
+        pieceItems_.at(to.y(), to.x()) = pieceItems_.at(from.y(), from.x());
+        pieceItems_.at(from.y(), from.x()) = nullptr;
+    }
+}
+
+// --------------------------------------------
+// Visual Updates
+// --------------------------------------------
+
+void AbstractTableGame::updateVisuals() {
+    for (int i = 0; i < changedCells_.size(); ++i) {
+        const QPoint cell = changedCells_.at(i);
+        changedFlags_.at(cell.y(), cell.x()) = false;
+        updateCell(cell.y(), cell.x());
+    }
+    changedCells_.clear();
+}
+
+void AbstractTableGame::markCellChanged(QPoint cell) {
+    if (!changedFlags_.isValid(cell.y(), cell.x()) || changedFlags_.at(cell.y(), cell.x())) {
+        return;
+    }
+    changedFlags_.at(cell.y(), cell.x()) = true;
+    changedCells_.append(cell);
+}
+
+void AbstractTableGame::markMoveChanged(const Move &move) {
+    markCellChanged(move.from);
+    markCellChanged(move.to);
+    for (const QPoint &captured : move.captures) {
+        markCellChanged(captured);
+    }
+}
+
+void AbstractTableGame::markAllCellsChanged() {
+    for (int row = 0; row < changedFlags_.rows(); ++row) {
+        for (int col = 0; col < changedFlags_.cols(); ++col) {
+            markCellChanged(QPoint(col, row));
+        }
+    }
+}
+
+void AbstractTableGame::removePieceItems() {
+    for (int row = 0; row < pieceItems_.rows(); ++row) {
+        for (int col = 0; col < pieceItems_.cols(); ++col) {
+            QAbstractGraphicsShapeItem *&item = pieceItems_.at(row, col);
+            if (item) {
+                removeItem(item);
+                delete item;
+                item = nullptr;
+            }
+        }
+    }
+}
+
+// --------------------------------------------
+// Player Management
+// --------------------------------------------
+
+bool AbstractTableGame::addPlayer(Player *player) {
+    Q_ASSERT(session_.rules());
+    return session_.addPlayer(player);
+}
+
 bool AbstractTableGame::managePlayer(Player *player) {
-    Q_ASSERT(rulesOfTheGame_);
-    if (rulesOfTheGame_->numberMaxPlayers() <= players_.size()) {
+    Q_ASSERT(session_.rules());
+    if (!AbstractTableGame::addPlayer(player)) {
         return false;
     }
 
-    AbstractTableGame::addPlayer(player);
     if(!managedPlayers.contains(player)){
         managedPlayers.append(player);
     }
@@ -138,19 +256,22 @@ void AbstractTableGame::mousePressEvent(QGraphicsSceneMouseEvent* event) {
     }
 
     // Check if drag is allowed
-    if (!rulesOfTheGame_ || !rulesOfTheGame_->isDragEnable()) {
+    if (!rulesOfTheGame() || !rulesOfTheGame()->isDragEnable()) {
         return;
     }
 
     // Check if it is your turn (managed Player)
-    if(!managedPlayers.contains(players_.current())){
+    if(!managedPlayers.contains(currentPlayer())){
         return;
     }
 
     // Check if it is your item
     QPoint pressGameItem = mapPositionToGame(event->scenePos());
-    PlayerEnums::PlayerPosition playerItem = gameState_.at(pressGameItem.ry(), pressGameItem.rx()).position;
-    if(players_.current()->playerPosition() != playerItem){
+    if (pressGameItem == QPoint(-1, -1)) {
+        return; // Pressed outside the board
+    }
+    PlayerEnums::PlayerPosition playerItem = getGameState().at(pressGameItem.ry(), pressGameItem.rx()).position;
+    if(currentPlayer()->playerPosition() != playerItem){
         return;
     }
 
@@ -160,6 +281,7 @@ void AbstractTableGame::mousePressEvent(QGraphicsSceneMouseEvent* event) {
         draggedItem_ = item;
         originalPos_ = item->pos();
         item->setCursor(QCursor(Qt::ClosedHandCursor));
+        showDragTargets(pressGameItem);
     }
 }
 
@@ -178,35 +300,37 @@ void AbstractTableGame::mouseMoveEvent(QGraphicsSceneMouseEvent* event) {
 void AbstractTableGame::mouseReleaseEvent(QGraphicsSceneMouseEvent* event) {
     QGraphicsScene::mouseReleaseEvent(event);
 
-    if (!gameOpen()) {
-        return;
-    }
-
-    // Check if it is your turn (managed Player)
-    if(!managedPlayers.contains(players_.current())){
+    // Check if the game is open and if it is your turn (managed Player)
+    if (!gameOpen() || !managedPlayers.contains(currentPlayer())) {
+        endDrag(false);
         return;
     }
 
     QPoint newPosition = mapPositionToGame(event->scenePos());
-    if (newPosition != QPoint(-1,-1)) {
-        QPoint previousPosition = newPosition;
-        if (rulesOfTheGame_->isDragEnable()) {
-            previousPosition = mapPositionToGame(originalPos_);
+
+    // Drag and drop: the move generated at press time for the drop cell is played as is
+    if (rulesOfTheGame()->isDragEnable()) {
+        if (!draggedItem_) {
+            return;
         }
 
-        bool isMoveAccepted = playMove(players_.current(), previousPosition, newPosition);
+        bool isMoveAccepted = false;
+        const auto target = dragTargets_.constFind(newPosition);
+        if (target != dragTargets_.constEnd()) {
+            isMoveAccepted = playMove(currentPlayer(), target.value());
+        } else {
+            emit invalidMove(currentPlayer());
+        }
 
         if (!isMoveAccepted) {
             qDebug() << "Invalid move!";
         }
+        endDrag(isMoveAccepted);
+        return;
+    }
 
-        if (draggedItem_) {
-            if (!isMoveAccepted) {
-                draggedItem_->setPos(originalPos_);
-            }
-            draggedItem_->setCursor(QCursor(Qt::ArrowCursor));
-            draggedItem_ = nullptr;
-        }
+    if (newPosition != QPoint(-1,-1) && !playMove(currentPlayer(), newPosition, newPosition)) {
+        qDebug() << "Invalid move!";
     }
 }
 
@@ -214,18 +338,80 @@ void AbstractTableGame::mouseReleaseEvent(QGraphicsSceneMouseEvent* event) {
 // Utility Functions
 // --------------------------------------------
 
+void AbstractTableGame::showDragTargets(QPoint from) {
+    // The legal moves only change with the game state: generate them once per position
+    if (!legalMovesCached_) {
+        rulesOfTheGame()->legalMoves(getGameState(), currentPlayer()->playerPosition(), legalMoves_, session_.tracker());
+        legalMovesCached_ = true;
+    }
+
+    for (const Move &move : legalMoves_) {
+        if (move.from != from || dragTargets_.contains(move.to)) {
+            continue;
+        }
+        dragTargets_.insert(move.to, move);
+        QGraphicsRectItem* cell = cells_.at(move.to.y(), move.to.x());
+        if (cell) {
+            targetBrushes_.insert(move.to, cell->brush());
+            cell->setBrush(QColor(58, 135, 94)); // Highlight the legal destination
+        }
+    }
+}
+
+void AbstractTableGame::endDrag(bool accepted) {
+    // Restore the highlighted cells
+    for (auto it = targetBrushes_.constBegin(); it != targetBrushes_.constEnd(); ++it) {
+        cells_.at(it.key().y(), it.key().x())->setBrush(it.value());
+    }
+    dragTargets_.clear();
+    targetBrushes_.clear();
+
+    if (draggedItem_) {
+        if (!accepted) {
+            draggedItem_->setPos(originalPos_);
+        }
+        draggedItem_->setCursor(QCursor(Qt::ArrowCursor));
+        draggedItem_ = nullptr;
+    }
+}
+
 bool AbstractTableGame::isGamePiece(QGraphicsItem* item) const {
-    return dynamic_cast<QGraphicsEllipseItem*>(item) || dynamic_cast<QGraphicsTextItem*>(item);
+    return dynamic_cast<QGraphicsEllipseItem*>(item) || dynamic_cast<QGraphicsSimpleTextItem*>(item);
+}
+
+void AbstractTableGame::setBoardGeometry(QPointF origin, QSizeF cellSize) {
+    boardOrigin_ = origin;
+    cellSize_ = cellSize;
 }
 
-QPoint AbstractTableGame::mapPositionToGame(QPointF position) {
+QPoint AbstractTableGame::mapPositionToGame(QPointF position) const {
+    if (cellSize_.isValid()) {
+        // Uniform grid: invert the cell layout
+        const int col = qFloor((position.x() - boardOrigin_.x()) / cellSize_.width());
+        const int row = qFloor((position.y() - boardOrigin_.y()) / cellSize_.height());
+        return cells_.isValid(row, col) ? QPoint(col, row) : QPoint(-1, -1);
+    }
+
+    // Other layouts: the scene index only returns the few items under the position
+    for (QGraphicsItem* item : items(position)) {
+        const QPoint cell = cellIndex_.value(item, QPoint(-1, -1));
+        if (cell != QPoint(-1, -1)) {
+            return cell;
+        }
+    }
+    return QPoint(-1, -1); // Invalid position
+}
+
+void AbstractTableGame::indexCells() {
+    cellIndex_.clear();
+    if (cellSize_.isValid()) {
+        return; // Not needed on a uniform grid
+    }
     for (int row = 0; row < cells_.rows(); ++row) {
         for (int col = 0; col < cells_.cols(); ++col) {
-            QGraphicsRectItem* cell = cells_.at(row, col);
-            if (cell && cell->contains(position)) {
-                return QPoint(col, row);
+            if (cells_.at(row, col)) {
+                cellIndex_.insert(cells_.at(row, col), QPoint(col, row));
             }
         }
     }
-    return QPoint(-1, -1); // Invalid position
 }
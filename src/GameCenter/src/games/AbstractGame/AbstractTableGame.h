@@ -1,21 +1,27 @@
 #ifndef ABSTRACTTABLEGAME_H
 #define ABSTRACTTABLEGAME_H
 
+#include <QBrush>
 #include <QGraphicsScene>
+#include <QHash>
 #include <QVector>
 #include <algorithm>
 #include "Player.h"
 #include "AbstractStrategyRulesGame.h"
+#include "GameSession.h"
 #include "framework/types/QCircularList.h"
 #include "framework/types/QMatrix.h"
 #include "framework/helpers.h"
 
+class QAbstractGraphicsShapeItem;
+
 /**
  * @class AbstractTableGame
- * @brief Abstract class for managing the logic of a board game.
+ * @brief Abstract class for displaying and playing a board game in a scene.
  *
- * This class provides the foundation for handling rules, players, and moves
- * in a board game, along with graphical updates and interaction.
+ * The game itself (rules, state, players, and moves) lives in a headless
+ * GameSession. This class is a view over it: it forwards the moves made in
+ * the scene, moves the graphical pieces and redraws the board.
  */
 class AbstractTableGame : public QGraphicsScene {
     Q_OBJECT
@@ -46,11 +52,12 @@ public:
 
     /**
      * @brief Updates the visuals of the board.
-     * @param player The player whose move to reflect.
-     * @param row The row of the move.
-     * @param col The column of the move.
+     *
+     * Only the cells changed since the last update (origin, destination and
+     * captures of the moves played, undone or redone) are passed to
+     * updateCell(), so a move costs the number of changed cells, not the board size.
      */
-    virtual void updateVisuals() = 0;
+    virtual void updateVisuals();
 
     /**
      * @brief Initializes the game setup (e.g., pieces, players).
@@ -79,17 +86,65 @@ public:
      */
     bool playMove(Player *player, QPoint originalPosition, QPoint nextPosition);
 
+    /**
+     * @brief Executes an exact move in the game, as a bot found it.
+     *
+     * Unlike the position based overload, the move keeps its captures, so a
+     * jump chain is played as searched even when another chain joins the same cells.
+     *
+     * @param player The player making the move.
+     * @param move The move, its player must be the player's position.
+     * @return True if the move is valid and executed, false otherwise.
+     */
+    bool playMove(Player *player, const Move &move);
+
+    /**
+     * @brief Takes back the last played move.
+     * @return True if a move was undone, false if the history is at its start.
+     */
+    bool undo();
+
+    /**
+     * @brief Plays again the last undone move.
+     * @return True if a move was redone, false if there is nothing to redo.
+     */
+    bool redo();
+
+    /**
+     * @brief Moves through the history to the position reached after a given number of moves.
+     *
+     * Intermediate positions are not drawn: the board is updated once at the end.
+     * Like undo() and redo(), it does not emit gameOver again when reaching a final position.
+     * @param moveCount The number of moves from the start of the game (0 to moveHistory().size()).
+     * @return True if the position was reached.
+     */
+    bool goToMove(int moveCount);
+
+    bool canUndo() const { return session_.canUndo(); }
+    bool canRedo() const { return session_.canRedo(); }
+
+    /**
+     * @brief Gets the moves played since the start of the game, undone moves included.
+     * @return The move history; the first historyIndex() moves are applied.
+     */
+    const QVector<Move>& moveHistory() const { return session_.moveHistory(); }
+
+    /**
+     * @brief Gets the number of moves currently applied.
+     */
+    int historyIndex() const { return session_.historyIndex(); }
+
     /**
      * @brief Gets the current player.
      * @return The current player.
      */
-    Player *currentPlayer() const { return players_.current(); }
+    Player *currentPlayer() const { return session_.currentPlayer(); }
 
     /**
      * @brief Gets the current game state.
      * @return A const reference to the game state matrix.
      */
-    const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& getGameState() const { return gameState_; }
+    const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& getGameState() const { return session_.state(); }
 
     /**
      * @brief Gets the rules of the game.
@@ -97,7 +152,52 @@ public:
      */
     AbstractStrategyRulesGame *rulesOfTheGame() const;
 
+    /**
+     * @brief Gets the headless game displayed by the scene.
+     */
+    const GameSession& session() const { return session_; }
+
 protected:
+    /**
+     * @brief Creates, updates or removes the graphical piece of a cell to match the game state.
+     *
+     * The piece item of the cell is pieceItems_.at(row, col); it is null when the cell has no piece yet.
+     * @param row The row of the cell.
+     * @param col The column of the cell.
+     */
+    virtual void updateCell(int row, int col) = 0;
+
+    /**
+     * @brief Declares the geometry of a uniform grid, so scene positions map to cells arithmetically.
+     *
+     * Cell (row, col) covers the rectangle at origin + (col, row) * cellSize.
+     * Games whose cells are not laid out this way do not call it: their cells
+     * are then found through the spatial index of the scene.
+     * @param origin Scene position of the top-left corner of cell (0, 0).
+     * @param cellSize Size of one cell in the scene.
+     */
+    void setBoardGeometry(QPointF origin, QSizeF cellSize);
+
+    /**
+     * @brief Marks a cell to be redrawn by the next updateVisuals().
+     */
+    void markCellChanged(QPoint cell);
+
+    /**
+     * @brief Marks the cells changed by a move (origin, destination and captures).
+     */
+    void markMoveChanged(const Move &move);
+
+    /**
+     * @brief Marks every cell of the board, to redraw all the pieces.
+     */
+    void markAllCellsChanged();
+
+    /**
+     * @brief Removes the graphical pieces from the scene, leaving the grid in place.
+     */
+    void removePieceItems();
+
     /**
      * @brief Handles mouse press events for interaction.
      * @param event Pointer to the mouse event.
@@ -124,6 +224,11 @@ signals:
      */
     void playerMoved(Player *player, const QPoint &playedPos);
 
+    /**
+     * @brief Emitted when a move is undone or redone.
+     */
+    void historyChanged();
+
     /**
      * @brief Emitted when a move is invalid.
      * @param player The player attempting the invalid move.
@@ -153,21 +258,43 @@ signals:
     void gameOpenChanged();
 
 protected:
-    AbstractStrategyRulesGame *rulesOfTheGame_; ///< Pointer to the game rules.
+    GameSession session_; ///< Rules, state, players and history of the game.
 
-    QMatrix<AbstractStrategyRulesGame::AtomicCellState> gameState_; ///< Current game state matrix.
     QMatrix<QGraphicsRectItem*> cells_; ///< Visual representation of the game grid.
+    QMatrix<QAbstractGraphicsShapeItem*> pieceItems_; ///< Graphical piece of each cell, parallel to the session state.
 
-    QCircularList<Player *> players_; ///< List of players in the game.
     QList<Player *> managedPlayers; ///< Players managed by the game.
 
 private:
     /**
      * @brief Maps a position from the scene to the game grid.
+     *
+     * Constant time on a uniform grid (see setBoardGeometry()); other layouts
+     * look the cell up among the scene items under the position.
      * @param position The position in the scene.
-     * @return The corresponding grid position.
+     * @return The corresponding grid position, (-1, -1) outside the board.
      */
-    QPoint mapPositionToGame(QPointF position);
+    QPoint mapPositionToGame(QPointF position) const;
+
+    /**
+     * @brief Indexes the cell items of a non-uniform board by their grid position.
+     */
+    void indexCells();
+
+    /**
+     * @brief Highlights the legal destinations of the piece picked on a cell.
+     *
+     * The legal moves of the position are generated by the rules at the first
+     * pick and reused until the game state changes.
+     * @param from The cell of the picked piece.
+     */
+    void showDragTargets(QPoint from);
+
+    /**
+     * @brief Removes the highlights and releases the dragged piece.
+     * @param accepted False to put the piece back on its cell.
+     */
+    void endDrag(bool accepted);
 
     /**
      * @brief Checks if an item is a game piece.
@@ -176,7 +303,40 @@ private:
      */
     bool isGamePiece(QGraphicsItem* item) const;
 
+    /**
+     * @brief Reverts the last applied move of the session, without updating the visuals.
+     */
+    void stepBack();
+
+    /**
+     * @brief Applies the next undone move of the session, without updating the visuals.
+     */
+    void stepForward();
+
+    /**
+     * @brief Moves the graphical piece of a cell along with its game piece.
+     */
+    void movePieceItem(QPoint from, QPoint to);
+
+    /**
+     * @brief Shows the move the session just played and reports it, then checks for game over.
+     * @param player The player who made the move.
+     */
+    void showPlayedMove(Player *player);
+
 private:
+    QPointF boardOrigin_; ///< Scene position of cell (0, 0) on a uniform grid.
+    QSizeF cellSize_;     ///< Cell size on a uniform grid, invalid for other layouts.
+    QHash<const QGraphicsItem*, QPoint> cellIndex_; ///< Grid position of each cell item of a non-uniform board.
+
+    QVector<Move> legalMoves_; ///< Legal moves of the current player in the current position.
+    bool legalMovesCached_;    ///< True while legalMoves_ matches the game state.
+    QHash<QPoint, Move> dragTargets_;     ///< Legal move of the dragged piece to each highlighted destination.
+    QHash<QPoint, QBrush> targetBrushes_; ///< Original brushes of the highlighted cells.
+
+    QVector<QPoint> changedCells_; ///< Cells to redraw at the next updateVisuals().
+    QMatrix<bool> changedFlags_;   ///< Cells already in changedCells_, parallel to the session state.
+
     QPointF originalPos_; ///< Original position of the dragged item.
     QGraphicsItem *draggedItem_; ///< Currently dragged game piece.
 };
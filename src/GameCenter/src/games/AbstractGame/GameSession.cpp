@@ -0,0 +1,146 @@
+#include "GameSession.h"
+
+GameSession::GameSession(AbstractStrategyRulesGame* rules)
+    : rules_(rules)
+{}
+
+// --------------------------------------------
+// Players
+// --------------------------------------------
+
+bool GameSession::addPlayer(Player* player) {
+    Q_ASSERT(rules_);
+    if (players_.contains(player)) {
+        return true;
+    }
+    if (rules_->numberMaxPlayers() <= players_.size()) {
+        return false;
+    }
+
+    player->setPlayerPosition(static_cast<PlayerEnums::PlayerPosition>(players_.size()));
+    players_.append(player);
+    return true;
+}
+
+int GameSession::missingPlayers() const {
+    Q_ASSERT(rules_);
+    return qMax(0, rules_->numberMinPlayers() - players_.size());
+}
+
+// --------------------------------------------
+// Game Start
+// --------------------------------------------
+
+bool GameSession::start(int rows, int cols) {
+    Q_ASSERT(rules_);
+    if (missingPlayers() > 0) {
+        return false;
+    }
+
+    state_ = rules_->initStatePlayers(rows, cols);
+    tracker_ = rules_->track(state_);
+    rules_->resetPositionHistory(state_);
+    history_.clear();
+    historyIndex_ = 0;
+    players_.rewind(); // The first player added always opens the game
+    open_ = true;
+    return true;
+}
+
+// --------------------------------------------
+// Move Logic
+// --------------------------------------------
+
+bool GameSession::playMove(Player* player, QPoint originalPosition, QPoint nextPosition) {
+    // Validate positions
+    if (!state_.isValid(originalPosition.y(), originalPosition.x()) || !state_.isValid(nextPosition.y(), nextPosition.x())) {
+        return false;
+    }
+
+    if (!open_ || player != players_.current()) {
+        return false;
+    }
+
+    return play(Move(originalPosition, nextPosition, player->playerPosition()));
+}
+
+bool GameSession::play(Move move) {
+    Q_ASSERT(rules_);
+    if (!open_ || move.player != players_.current()->playerPosition() || !rules_->validate(state_, move, tracker_.get())) {
+        return false;
+    }
+
+    // Update game state in place
+    rules_->apply(state_, move, tracker_.get());
+    rules_->recordPosition(state_, tracker_.get());
+
+    // A new move discards the undone moves
+    history_.resize(historyIndex_);
+    history_.append(move);
+    ++historyIndex_;
+
+    players_.next();
+    updateOpen();
+    return true;
+}
+
+PlayerEnums::PlayerPosition GameSession::winner() const {
+    return rules_ ? rules_->checkWin(state_, tracker_.get()) : PlayerEnums::Unknown;
+}
+
+void GameSession::updateOpen() {
+    open_ = !rules_->isGameOver(state_, tracker_.get());
+}
+
+// --------------------------------------------
+// Undo / Redo
+// --------------------------------------------
+
+bool GameSession::undo() {
+    if (!canUndo()) {
+        return false;
+    }
+
+    stepBack();
+    updateOpen();
+    return true;
+}
+
+bool GameSession::redo() {
+    if (!canRedo()) {
+        return false;
+    }
+
+    stepForward();
+    updateOpen();
+    return true;
+}
+
+bool GameSession::goToMove(int moveCount) {
+    if (moveCount < 0 || moveCount > history_.size()) {
+        return false;
+    }
+
+    while (historyIndex_ > moveCount) {
+        stepBack();
+    }
+    while (historyIndex_ < moveCount) {
+        stepForward();
+    }
+    updateOpen();
+    return true;
+}
+
+void GameSession::stepBack() {
+    const Move &move = history_.at(--historyIndex_);
+    rules_->forgetPosition(state_, tracker_.get());
+    rules_->unapply(state_, move, tracker_.get());
+    players_.previous();
+}
+
+void GameSession::stepForward() {
+    Move &move = history_[historyIndex_++];
+    rules_->apply(state_, move, tracker_.get());
+    rules_->recordPosition(state_, tracker_.get());
+    players_.next();
+}
@@ -0,0 +1,171 @@
+#ifndef GAMESESSION_H
+#define GAMESESSION_H
+
+#include <QPoint>
+#include <QVector>
+#include <memory>
+#include "Player.h"
+#include "AbstractStrategyRulesGame.h"
+#include "framework/types/QCircularList.h"
+#include "framework/types/QMatrix.h"
+
+/**
+ * @class GameSession
+ * @brief Headless core of a game: rules, state, player rotation and move history.
+ *
+ * A session plays a whole game without any graphics: it validates and applies
+ * moves, hands the turn to the next player, detects the end of the game and
+ * keeps the history for undo and redo. It is neither a QObject nor a scene,
+ * so render-less servers and tools run bot-vs-bot games with it directly.
+ *
+ * AbstractTableGame is a view over a session: it forwards the moves of the
+ * scene and redraws the board from the session state.
+ */
+class GameSession {
+public:
+    /**
+     * @brief Constructor.
+     * @param rules Pointer to the game rules (not owned).
+     */
+    explicit GameSession(AbstractStrategyRulesGame *rules = nullptr);
+
+    /**
+     * @brief Installs the game rules.
+     * @param rules Pointer to the game rules (not owned).
+     */
+    void installRules(AbstractStrategyRulesGame *rules) {
+        rules_ = rules;
+        tracker_.reset(); // The tracker of the previous rules does not fit the new ones
+    }
+
+    /**
+     * @brief Gets the rules of the game.
+     */
+    AbstractStrategyRulesGame *rules() const { return rules_; }
+
+    /**
+     * @brief Adds a player and assigns them the next free position.
+     * @param player The player to add.
+     * @return False if the game is already full.
+     */
+    bool addPlayer(Player *player);
+
+    /**
+     * @brief Gets the players, in turn order.
+     */
+    const QCircularList<Player *> &players() const { return players_; }
+
+    /**
+     * @brief Number of players still needed to start the game (0 if enough).
+     */
+    int missingPlayers() const;
+
+    /**
+     * @brief Starts a new game on an empty board, the first player added moves first.
+     * @param rows Number of rows of the board.
+     * @param cols Number of columns of the board.
+     * @return False if players are missing, the game is then left unchanged.
+     */
+    bool start(int rows, int cols);
+
+    /**
+     * @brief Plays a move of a player.
+     * @param player The player making the move, it must be the current player.
+     * @param originalPosition The initial position of the piece.
+     * @param nextPosition The destination position of the piece.
+     * @return True if the move is valid and was played.
+     */
+    bool playMove(Player *player, QPoint originalPosition, QPoint nextPosition);
+
+    /**
+     * @brief Plays a move of the current player.
+     * @param move The move, its player must be the current player's position.
+     * @return True if the move is valid and was played.
+     */
+    bool play(Move move);
+
+    /**
+     * @brief Takes back the last played move.
+     * @return True if a move was undone, false if the history is at its start.
+     */
+    bool undo();
+
+    /**
+     * @brief Plays again the last undone move.
+     * @return True if a move was redone, false if there is nothing to redo.
+     */
+    bool redo();
+
+    /**
+     * @brief Moves through the history to the position reached after a given number of moves.
+     * @param moveCount The number of moves from the start of the game (0 to moveHistory().size()).
+     * @return True if the position was reached.
+     */
+    bool goToMove(int moveCount);
+
+    bool canUndo() const { return historyIndex_ > 0; }
+    bool canRedo() const { return historyIndex_ < history_.size(); }
+
+    /**
+     * @brief Gets the moves played since the start of the game, undone moves included.
+     * @return The move history; the first historyIndex() moves are applied.
+     */
+    const QVector<Move> &moveHistory() const { return history_; }
+
+    /**
+     * @brief Gets the number of moves currently applied.
+     */
+    int historyIndex() const { return historyIndex_; }
+
+    /**
+     * @brief Gets the current player.
+     */
+    Player *currentPlayer() const { return players_.current(); }
+
+    /**
+     * @brief Gets the current game state.
+     */
+    const AbstractStrategyRulesGame::State &state() const { return state_; }
+
+    /**
+     * @brief Gets the incremental data the rules keep beside the current state.
+     * @return The tracker to pass to the rules queries on state(), or null if the game has none.
+     */
+    const AbstractStrategyRulesGame::Tracker *tracker() const { return tracker_.get(); }
+
+    /**
+     * @brief Checks whether the game is started and not over.
+     */
+    bool isOpen() const { return open_; }
+
+    /**
+     * @brief Gets the winner of the current position (Unknown while playing or on a draw).
+     */
+    PlayerEnums::PlayerPosition winner() const;
+
+private:
+    /**
+     * @brief Reverts the last applied move.
+     */
+    void stepBack();
+
+    /**
+     * @brief Applies the next undone move.
+     */
+    void stepForward();
+
+    /**
+     * @brief Reopens or closes the game after the state changed.
+     */
+    void updateOpen();
+
+    AbstractStrategyRulesGame *rules_;        ///< Pointer to the game rules.
+    AbstractStrategyRulesGame::State state_;  ///< Current game state matrix.
+    std::unique_ptr<AbstractStrategyRulesGame::Tracker> tracker_; ///< Incremental data of state_, kept in step by the rules.
+    QCircularList<Player *> players_;         ///< Players in turn order.
+    QVector<Move> history_;                   ///< Moves played since the start of the game, with their undo information.
+    int historyIndex_ = 0;                    ///< Number of moves of history_ currently applied.
+    bool open_ = false;                       ///< The game is started and not over.
+};
+
+#endif // GAMESESSION_H
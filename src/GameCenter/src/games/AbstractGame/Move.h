@@ -0,0 +1,53 @@
+#ifndef MOVE_H
+#define MOVE_H
+
+#include <QPoint>
+#include <QVarLengthArray>
+#include "Player.h"
+
+/**
+ * @struct Move
+ * @brief A single move, described by its delta rather than by a whole board.
+ *
+ * Positions are (column, row) points, like in AbstractTableGame::playMove.
+ * For placement games (Go, TicTacToe) `from` and `to` are the same cell.
+ *
+ * `captures` and `promotion` are filled by the rules when the move is
+ * applied, so the caller learns which cells were emptied without comparing
+ * boards. When several moves join the same cells (two checkers jump paths),
+ * setting `captures` before validation selects one of them.
+ *
+ * Once applied, a move holds everything needed to revert it (captured pieces
+ * and promotion), so rules can unapply it and a search can walk a game tree
+ * on a single board.
+ *
+ * Captures are stored inside the move up to InlineCaptures cells, which
+ * covers any checkers jump chain, so generating and copying moves does not
+ * allocate. Only a Go move capturing a larger group spills to the heap.
+ */
+struct Move {
+    static constexpr int InlineCaptures = 12; ///< Captured cells stored without allocation.
+
+    using Captures = QVarLengthArray<QPoint, InlineCaptures>;
+    using CapturedTypes = QVarLengthArray<quint8, InlineCaptures>;
+
+    QPoint from;                                           ///< Cell the piece leaves (same as `to` for a placement).
+    QPoint to;                                             ///< Cell the piece lands on.
+    PlayerEnums::PlayerPosition player = PlayerEnums::Unknown; ///< Player making the move.
+    Captures captures;                                     ///< Cells emptied by the move.
+    CapturedTypes capturedTypes;                           ///< Piece type of each captured cell, parallel to `captures`.
+    bool promotion = false;                                ///< True if the moved piece was promoted.
+
+    Move() = default;
+    Move(QPoint from, QPoint to, PlayerEnums::PlayerPosition player)
+        : from(from), to(to), player(player) {}
+
+    /**
+     * @brief Builds a placement move (a stone or a mark put on an empty cell).
+     */
+    static Move placement(QPoint cell, PlayerEnums::PlayerPosition player) { return Move(cell, cell, player); }
+
+    bool isPlacement() const { return from == to; }
+};
+
+#endif // MOVE_H
@@ -0,0 +1,118 @@
+#ifndef PERFT_H
+#define PERFT_H
+
+#include <QElapsedTimer>
+#include <QPair>
+#include <QVector>
+#include "AbstractStrategyRulesGame.h"
+
+/**
+ * @class Perft
+ * @brief Counts the legal move sequences of a game tree, to check and time the move generators.
+ *
+ * perft(d) is the number of legal move sequences of length d from a position;
+ * positions where the game is over are not expanded. Known counts make it a
+ * correctness oracle for AbstractStrategyRulesGame::legalMoves(), and the
+ * nodes per second measure the generator together with apply() and unapply().
+ *
+ * The walk plays the moves on a single board, with a reversible tracker
+ * of its own for the incremental data of the rules, and records each
+ * position in the rules history while it is on the board, so Go superko
+ * applies along every line.
+ */
+class Perft {
+public:
+    /**
+     * @brief Count of one perft run.
+     */
+    struct Result {
+        int depth = 0;
+        quint64 nodes = 0;      ///< Move sequences of length depth.
+        qint64 elapsedNs = 0;   ///< Time of the walk.
+
+        double nodesPerSecond() const { return elapsedNs > 0 ? nodes * 1e9 / elapsedNs : 0.0; }
+    };
+
+    /**
+     * @brief Counts the move sequences of a given length.
+     * @param rules The rules, their position history is restored on return.
+     * @param state The position to start from.
+     * @param player The player to move.
+     * @param depth Length of the sequences (0 counts the position itself).
+     */
+    static Result run(AbstractStrategyRulesGame &rules, const AbstractStrategyRulesGame::State &state,
+                      PlayerEnums::PlayerPosition player, int depth) {
+        QElapsedTimer timer;
+        timer.start();
+
+        AbstractStrategyRulesGame::State board = state;
+        const std::unique_ptr<AbstractStrategyRulesGame::Tracker> tracker = rules.track(board, true);
+        QVector<QVector<Move>> buffers(qMax(depth, 1));
+        Result result;
+        result.depth = depth;
+        result.nodes = count(rules, board, tracker.get(), player, depth, buffers);
+        result.elapsedNs = timer.nsecsElapsed();
+        return result;
+    }
+
+    /**
+     * @brief Splits the count of run() by first move, to locate a wrong count.
+     * @return Each legal move of the player with the number of sequences it starts.
+     */
+    static QVector<QPair<Move, quint64>> divide(AbstractStrategyRulesGame &rules, const AbstractStrategyRulesGame::State &state,
+                                                PlayerEnums::PlayerPosition player, int depth) {
+        QVector<QPair<Move, quint64>> counts;
+        if (depth < 1 || rules.isGameOver(state)) {
+            return counts;
+        }
+
+        AbstractStrategyRulesGame::State board = state;
+        const std::unique_ptr<AbstractStrategyRulesGame::Tracker> tracker = rules.track(board, true);
+        QVector<QVector<Move>> buffers(depth);
+        QVector<Move> moves;
+        rules.legalMoves(board, player, moves, tracker.get());
+        for (Move &move : moves) {
+            const Move played = move;
+            rules.apply(board, move, tracker.get());
+            rules.recordPosition(board, tracker.get());
+            counts.append(qMakePair(played, count(rules, board, tracker.get(), opponentOf(player), depth - 1, buffers)));
+            rules.forgetPosition(board, tracker.get());
+            rules.unapply(board, move, tracker.get());
+        }
+        return counts;
+    }
+
+private:
+    static PlayerEnums::PlayerPosition opponentOf(PlayerEnums::PlayerPosition player) {
+        return player == PlayerEnums::Player1 ? PlayerEnums::Player2 : PlayerEnums::Player1;
+    }
+
+    static quint64 count(AbstractStrategyRulesGame &rules, AbstractStrategyRulesGame::State &board, AbstractStrategyRulesGame::Tracker *tracker,
+                         PlayerEnums::PlayerPosition player, int depth, QVector<QVector<Move>> &buffers) {
+        if (depth == 0) {
+            return 1;
+        }
+        if (rules.isGameOver(board, tracker)) {
+            return 0;
+        }
+
+        // One move buffer per depth: no allocation once the buffers have grown
+        QVector<Move> &moves = buffers[depth - 1];
+        rules.legalMoves(board, player, moves, tracker);
+        if (depth == 1) {
+            return moves.size(); // The last level only needs the number of moves
+        }
+
+        quint64 nodes = 0;
+        for (Move &move : moves) {
+            rules.apply(board, move, tracker);
+            rules.recordPosition(board, tracker);
+            nodes += count(rules, board, tracker, opponentOf(player), depth - 1, buffers);
+            rules.forgetPosition(board, tracker);
+            rules.unapply(board, move, tracker);
+        }
+        return nodes;
+    }
+};
+
+#endif // PERFT_H
@@ -17,7 +17,7 @@ namespace PlayerEnums {
      * @enum PlayerPosition
      * @brief Represents possible positions of players.
      */
-enum PlayerPosition {
+enum PlayerPosition : quint8 {
     Player1 = 0, ///< The first player
     Player2,     ///< The second player
     Player3,     ///< The third player
@@ -0,0 +1,326 @@
+#ifndef CHECKERSBITBOARD_H
+#define CHECKERSBITBOARD_H
+
+#include "AbstractGame/AbstractStrategyRulesGame.h"
+#include <QtGlobal>
+#include <QtAlgorithms>
+#include <array>
+
+/**
+ * @class CheckersBitboard
+ * @brief 32-square bitboard representation of an 8x8 checkers position.
+ *
+ * Only dark squares (row + col odd) are playable, four per row. Square `s`
+ * maps to row `s / 4`; a bit set in a 32-bit word marks a piece on that square.
+ * Player1 moves towards increasing rows (Up), Player2 towards decreasing rows (Down).
+ *
+ * Moves are generated for every piece of a side at once with shifts: one
+ * diagonal step is a shift by 3, 4 or 5 depending on the row parity, masked so
+ * that pieces never wrap around the board edges. Jump chains are explored with
+ * a depth-first search that only touches the three bitboard words.
+ */
+class CheckersBitboard {
+public:
+    /**
+     * @brief Direction of play of a side.
+     */
+    enum Side {
+        Up = 0,  ///< Player1, starts on rows 0-2 and promotes on row 7.
+        Down = 1 ///< Player2, starts on rows 5-7 and promotes on row 0.
+    };
+
+    /**
+     * @brief A complete move: simple step, single jump or multi-jump chain.
+     */
+    struct Move {
+        quint8 from = 0;           ///< Square (0-31) the piece leaves.
+        quint8 to = 0;             ///< Square (0-31) the piece lands on at the end of the move.
+        quint32 captures = 0;      ///< Squares of the captured pieces.
+        quint32 capturedKings = 0; ///< Subset of `captures` that were kings.
+        bool promotion = false;    ///< True when a man reaches the king row.
+
+        bool isCapture() const { return captures != 0; }
+    };
+
+    /**
+     * @brief Fixed-capacity move list, so generation never allocates.
+     */
+    class MoveList {
+    public:
+        static constexpr int Capacity = 128;
+
+        void append(const Move &move) {
+            Q_ASSERT(count_ < Capacity);
+            if (count_ < Capacity) {
+                moves_[count_++] = move;
+            }
+        }
+        void clear() { count_ = 0; }
+        int size() const { return count_; }
+        bool isEmpty() const { return count_ == 0; }
+        const Move &at(int index) const { return moves_[index]; }
+        const Move *begin() const { return moves_.data(); }
+        const Move *end() const { return moves_.data() + count_; }
+
+    private:
+        std::array<Move, Capacity> moves_;
+        int count_ = 0;
+    };
+
+    CheckersBitboard() = default;
+
+    /**
+     * @brief Builds a bitboard from an 8x8 rules state.
+     *
+     * Pieces with typeId 2 are kings. Pieces on light squares are ignored.
+     */
+    static CheckersBitboard fromState(const QMatrix<AbstractStrategyRulesGame::AtomicCellState> &state) {
+        CheckersBitboard board;
+        for (int square = 0; square < 32; ++square) {
+            const AbstractStrategyRulesGame::AtomicCellState cell = state.at(rowOf(square), colOf(square));
+            if (cell.position == PlayerEnums::Player1 || cell.position == PlayerEnums::Player2) {
+                board.pieces_[sideOf(cell.position)] |= bit(square);
+                if (cell.typeId == 2) {
+                    board.kings_ |= bit(square);
+                }
+            }
+        }
+        return board;
+    }
+
+    static Side sideOf(PlayerEnums::PlayerPosition position) {
+        return position == PlayerEnums::Player1 ? Up : Down;
+    }
+
+    static PlayerEnums::PlayerPosition positionOf(Side side) {
+        return side == Up ? PlayerEnums::Player1 : PlayerEnums::Player2;
+    }
+
+    static Side opponent(Side side) { return side == Up ? Down : Up; }
+
+    /**
+     * @brief Converts a board position into a square index.
+     * @return The square (0-31), or -1 for a light square.
+     */
+    static int squareOf(int row, int col) {
+        if (row < 0 || row >= 8 || col < 0 || col >= 8 || (row + col) % 2 == 0) {
+            return -1;
+        }
+        return row * 4 + col / 2;
+    }
+
+    static int rowOf(int square) { return square / 4; }
+    static int colOf(int square) { return 2 * (square % 4) + ((square / 4) % 2 == 0 ? 1 : 0); }
+
+    quint32 pieces(Side side) const { return pieces_[side]; }
+    quint32 kings() const { return kings_; }
+    quint32 occupied() const { return pieces_[Up] | pieces_[Down]; }
+    quint32 empty() const { return ~occupied(); }
+
+    /**
+     * @brief Generates the legal moves of a side: complete jump chains, or simple steps when no jump exists.
+     *
+     * Capturing is mandatory: as soon as one jump is available only the jump
+     * chains are legal (any of them, not necessarily the longest). A jump chain
+     * ends when no further capture is available or when a man is crowned.
+     * Captured pieces stay on the board until the chain ends, so a piece
+     * cannot be jumped twice.
+     *
+     * @param side The side to move.
+     * @param moves Receives the moves (cleared first).
+     */
+    void generateMoves(Side side, MoveList &moves) const {
+        moves.clear();
+        generateJumps(side, moves);
+        if (moves.isEmpty()) {
+            generateSimpleMoves(side, moves);
+        }
+    }
+
+    /**
+     * @brief Generates the jump chains of a side only.
+     * @param side The side to move.
+     * @param moves Receives the moves (appended).
+     */
+    void generateJumps(Side side, MoveList &moves) const {
+        quint32 movers = pieces_[side];
+        while (movers) {
+            const int from = qCountTrailingZeroBits(movers);
+            movers &= movers - 1;
+            const int first = moves.size();
+            collectJumps(side, from, bit(from), (kings_ & bit(from)) != 0, 0, 0, first, moves);
+        }
+    }
+
+    /**
+     * @brief Generates the simple (non-capturing) steps of a side only.
+     * @param side The side to move.
+     * @param moves Receives the moves (appended).
+     */
+    void generateSimpleMoves(Side side, MoveList &moves) const {
+        const quint32 freeSquares = empty();
+        const quint32 men = pieces_[side] & ~kings_;
+        const quint32 kings = pieces_[side] & kings_;
+        const quint32 forward = (side == Up) ? men | kings : kings;
+        const quint32 backward = (side == Up) ? kings : men | kings;
+
+        appendSteps(stepUpRight(forward) & freeSquares, &CheckersBitboard::stepDownLeft, side, moves);
+        appendSteps(stepUpLeft(forward) & freeSquares, &CheckersBitboard::stepDownRight, side, moves);
+        appendSteps(stepDownRight(backward) & freeSquares, &CheckersBitboard::stepUpLeft, side, moves);
+        appendSteps(stepDownLeft(backward) & freeSquares, &CheckersBitboard::stepUpRight, side, moves);
+    }
+
+    /**
+     * @brief Plays a move generated for a side.
+     */
+    void makeMove(Side side, const Move &move) {
+        const quint32 fromBit = bit(move.from);
+        const quint32 toBit = bit(move.to);
+        pieces_[side] = (pieces_[side] & ~fromBit) | toBit;
+        pieces_[opponent(side)] &= ~move.captures;
+        if ((kings_ & fromBit) || move.promotion) {
+            kings_ = (kings_ & ~fromBit) | toBit;
+        }
+        kings_ &= ~move.captures;
+    }
+
+    /**
+     * @brief Reverts a move previously played with makeMove().
+     */
+    void unmakeMove(Side side, const Move &move) {
+        const quint32 fromBit = bit(move.from);
+        const quint32 toBit = bit(move.to);
+        pieces_[side] = (pieces_[side] & ~toBit) | fromBit;
+        pieces_[opponent(side)] |= move.captures;
+        if (kings_ & toBit) {
+            kings_ &= ~toBit;
+            if (!move.promotion) {
+                kings_ |= fromBit;
+            }
+        }
+        kings_ |= move.capturedKings;
+    }
+
+    /**
+     * @brief Counts the leaf nodes of the move tree down to a given depth.
+     *
+     * Used as a correctness oracle and throughput benchmark for the generator.
+     *
+     * @param side The side to move at the root.
+     * @param depth The number of plies to explore.
+     * @return The number of positions reached at exactly `depth` plies.
+     */
+    quint64 perft(Side side, int depth) const {
+        if (depth <= 0) {
+            return 1;
+        }
+        MoveList moves;
+        generateMoves(side, moves);
+        if (depth == 1) {
+            return static_cast<quint64>(moves.size());
+        }
+        quint64 nodes = 0;
+        CheckersBitboard child = *this;
+        for (const Move &move : moves) {
+            child.makeMove(side, move);
+            nodes += child.perft(opponent(side), depth - 1);
+            child.unmakeMove(side, move);
+        }
+        return nodes;
+    }
+
+    bool operator==(const CheckersBitboard &other) const {
+        return pieces_[Up] == other.pieces_[Up] && pieces_[Down] == other.pieces_[Down] && kings_ == other.kings_;
+    }
+
+    static quint32 bit(int square) { return quint32(1) << square; }
+
+private:
+    // Row-parity masks: squares 0-3 are on row 0, 4-7 on row 1, ...
+    static constexpr quint32 EvenRows = 0x0F0F0F0Fu;      ///< Rows 0, 2, 4, 6 (dark squares on odd columns).
+    static constexpr quint32 OddRows = 0xF0F0F0F0u;       ///< Rows 1, 3, 5, 7 (dark squares on even columns).
+    static constexpr quint32 EvenNotRight = 0x07070707u;  ///< Even rows without column 7.
+    static constexpr quint32 OddNotLeft = 0xE0E0E0E0u;    ///< Odd rows without column 0.
+    static constexpr quint32 KingRowUp = 0xF0000000u;     ///< Row 7, where Player1 men are crowned.
+    static constexpr quint32 KingRowDown = 0x0000000Fu;   ///< Row 0, where Player2 men are crowned.
+
+    // One diagonal step for every bit of a word at once (shifts beyond the board drop out).
+    static quint32 stepUpRight(quint32 b) { return ((b & EvenNotRight) << 5) | ((b & OddRows) << 4); }
+    static quint32 stepUpLeft(quint32 b) { return ((b & EvenRows) << 4) | ((b & OddNotLeft) << 3); }
+    static quint32 stepDownRight(quint32 b) { return ((b & EvenNotRight) >> 3) | ((b & OddRows) >> 4); }
+    static quint32 stepDownLeft(quint32 b) { return ((b & EvenRows) >> 4) | ((b & OddNotLeft) >> 5); }
+
+    using Step = quint32 (*)(quint32);
+
+    static bool isKingRow(Side side, quint32 squareBit) {
+        return (squareBit & (side == Up ? KingRowUp : KingRowDown)) != 0;
+    }
+
+    void appendSteps(quint32 targets, Step backwards, Side side, MoveList &moves) const {
+        while (targets) {
+            const int to = qCountTrailingZeroBits(targets);
+            targets &= targets - 1;
+            const quint32 fromBit = backwards(bit(to));
+            Move move;
+            move.from = static_cast<quint8>(qCountTrailingZeroBits(fromBit));
+            move.to = static_cast<quint8>(to);
+            move.promotion = !(kings_ & fromBit) && isKingRow(side, bit(to));
+            moves.append(move);
+        }
+    }
+
+    void collectJumps(Side side, int from, quint32 current, bool isKing, quint32 captured, quint32 capturedKings, int firstOfPiece, MoveList &moves) const {
+        const quint32 opponents = pieces_[opponent(side)] & ~captured;
+        // The moving piece has left its origin square; captured pieces still block landings.
+        const quint32 freeSquares = ~((pieces_[side] & ~bit(from)) | pieces_[opponent(side)]);
+
+        static constexpr Step directions[4] = { &CheckersBitboard::stepUpRight, &CheckersBitboard::stepUpLeft,
+                                                &CheckersBitboard::stepDownRight, &CheckersBitboard::stepDownLeft };
+        const int firstDirection = (isKing || side == Up) ? 0 : 2;
+        const int lastDirection = (isKing || side == Down) ? 4 : 2;
+
+        bool extended = false;
+        for (int d = firstDirection; d < lastDirection; ++d) {
+            const quint32 over = directions[d](current) & opponents;
+            const quint32 landing = directions[d](over) & freeSquares;
+            if (!landing) {
+                continue;
+            }
+            extended = true;
+            const quint32 nextCaptured = captured | over;
+            const quint32 nextCapturedKings = capturedKings | (over & kings_);
+            if (!isKing && isKingRow(side, landing)) {
+                // A crowned man ends its move
+                appendJump(from, landing, nextCaptured, nextCapturedKings, true, firstOfPiece, moves);
+            } else {
+                collectJumps(side, from, landing, isKing, nextCaptured, nextCapturedKings, firstOfPiece, moves);
+            }
+        }
+
+        if (!extended && captured) {
+            appendJump(from, current, captured, capturedKings, false, firstOfPiece, moves);
+        }
+    }
+
+    static void appendJump(int from, quint32 landing, quint32 captured, quint32 capturedKings, bool promotion, int firstOfPiece, MoveList &moves) {
+        const int to = qCountTrailingZeroBits(landing);
+        // Kings can reach the same result through different orders: keep one
+        for (int i = firstOfPiece; i < moves.size(); ++i) {
+            if (moves.at(i).to == to && moves.at(i).captures == captured) {
+                return;
+            }
+        }
+        Move move;
+        move.from = static_cast<quint8>(from);
+        move.to = static_cast<quint8>(to);
+        move.captures = captured;
+        move.capturedKings = capturedKings;
+        move.promotion = promotion;
+        moves.append(move);
+    }
+
+    quint32 pieces_[2] = { 0, 0 }; ///< Pieces of each side, indexed by Side.
+    quint32 kings_ = 0;            ///< Kings of both sides.
+};
+
+#endif // CHECKERSBITBOARD_H
@@ -16,13 +16,12 @@ public:
     explicit CheckersGame(QObject* parent = nullptr);
 
 protected:
-    void updateVisuals() override;
+    void updateCell(int row, int col) override;
     void initializeGame() override;
 
 private:
     void drawGrid();
     void initializePieces();
-    void cleanUpGame();
     QString pieceToString(AbstractStrategyRulesGame::AtomicCellState cellState) const;
     QSize gridSize_;
 };
@@ -3,6 +3,7 @@
 
 #include "AbstractGame/AbstractStrategyRulesGame.h"
 #include "AbstractGame/Player.h"
+#include "CheckersBitboard.h"
 #include <QFile>
 
 class CheckersRules : public AbstractStrategyRulesGame {
@@ -10,6 +11,8 @@ public:
     explicit CheckersRules() = default;
     ~CheckersRules() override = default;
 
+    std::unique_ptr<AbstractStrategyRulesGame> clone() const override { return std::make_unique<CheckersRules>(*this); }
+
     // Retourne le nom du jeu
     QString gameName() const override { return QStringLiteral("Checkers"); }
 
@@ -24,15 +27,15 @@ public:
     bool isDragEnable() const override { return true; }
 
     QMatrix<AbstractStrategyRulesGame::AtomicCellState> initStatePlayers(int gridX, int gridY) const override {
-        QMatrix<AbstractStrategyRulesGame::AtomicCellState> state(gridX, gridY, { PlayerEnums::Unknown, 0 , nullptr});
+        QMatrix<AbstractStrategyRulesGame::AtomicCellState> state(gridX, gridY, { PlayerEnums::Unknown, 0 });
 
         for (int row = 0; row < gridX; ++row) {
             for (int col = 0; col < gridY; ++col) {
                 if ((row + col) % 2 == 1) { // Case noire
                     if (row < 3) {
-                        state.at(row, col) = { PlayerEnums::Player1, 1, nullptr }; // Pion du joueur 1
+                        state.at(row, col) = { PlayerEnums::Player1, 1 }; // Pion du joueur 1
                     } else if (row >= gridX - 3) {
-                        state.at(row, col) = { PlayerEnums::Player2, 1 , nullptr }; // Pion du joueur 2
+                        state.at(row, col) = { PlayerEnums::Player2, 1 }; // Pion du joueur 2
                     }
                 }
             }
@@ -40,54 +43,69 @@ public:
         return state;
     }
 
-    bool isMoveValid(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& beforeState, QMatrix<AbstractStrategyRulesGame::AtomicCellState>& afterState, Player *player) override {
-        if (beforeState.rows() != afterState.rows() || beforeState.cols() != afterState.cols()) {
+    bool validate(const State& state, const Move& move, const Tracker* = nullptr) const override {
+        // Une rafle de dame peut revenir sur sa case de départ : from == to n'est pas refusé ici
+        if (move.player == PlayerEnums::Unknown
+            || !state.isValid(move.from.y(), move.from.x()) || !state.isValid(move.to.y(), move.to.x())) {
             return false;
         }
 
-        int changes = 0;
-        int startRow = -1, startCol = -1;
-        int endRow = -1, endCol = -1;
-
-        for (int row = 0; row < beforeState.rows(); ++row) {
-            for (int col = 0; col < beforeState.cols(); ++col) {
-                if (beforeState.at(row, col).position != afterState.at(row, col).position) {
-                    if (beforeState.at(row, col).position == player->playerPosition()) {
-                        startRow = row;
-                        startCol = col;
-                    } else if (afterState.at(row, col).position == player->playerPosition()) {
-                        endRow = row;
-                        endCol = col;
-                    } else {
-                        return false; // Mouvement invalide
-                    }
-                    ++changes;
-                }
-            }
+        // Plateau standard 8x8 : le coup doit faire partie des coups générés (déplacement simple ou rafle complète)
+        if (isStandardBoard(state)) {
+            CheckersBitboard::Move generated;
+            return findStandardMove(state, move, generated);
         }
 
-        // Vérification des mouvements simples ou captures
-        if (changes == 2) {
-            if (isSimpleMoveValid(beforeState, startRow, startCol, endRow, endCol, player)) {
-                // Promotion en dame si le pion atteint la dernière rangée
-                promoteToKing(afterState, endRow, endCol, player);
-                return true;
-            } else if (isCaptureMoveValid(beforeState, startRow, startCol, endRow, endCol, player)) {
-                // Retirer la pièce capturée
-                int midRow = (startRow + endRow) / 2;
-                int midCol = (startCol + endCol) / 2;
-                afterState.at(midRow, midCol) = { PlayerEnums::Unknown, 0, nullptr };
-
-                // Promotion en dame si le pion atteint la dernière rangée
-                promoteToKing(afterState, endRow, endCol, player);
-                return true;
+        // Autres tailles : même règle (prise obligatoire, rafles complètes) avec le générateur générique
+        Move generated;
+        return findBoardMove(state, move, generated);
+    }
+
+    void apply(State& state, Move& move, Tracker* = nullptr) const override {
+        const AbstractStrategyRulesGame::AtomicCellState piece = state.at(move.from.y(), move.from.x());
+
+        if (isStandardBoard(state)) {
+            CheckersBitboard::Move generated;
+            findStandardMove(state, move, generated);
+            move.captures.clear();
+            move.capturedTypes.clear();
+            quint32 captures = generated.captures;
+            while (captures) {
+                const int square = qCountTrailingZeroBits(captures);
+                captures &= captures - 1;
+                move.captures.append(QPoint(CheckersBitboard::colOf(square), CheckersBitboard::rowOf(square)));
+                move.capturedTypes.append((generated.capturedKings & CheckersBitboard::bit(square)) ? 2 : 1);
             }
+            move.promotion = generated.promotion;
+        } else {
+            Move generated;
+            findBoardMove(state, move, generated);
+            move.captures = generated.captures;
+            move.capturedTypes = generated.capturedTypes;
+            move.promotion = generated.promotion;
         }
 
-        return false;
+        // Retirer les pièces capturées puis déplacer la pièce (promotion en dame si besoin)
+        for (const QPoint& captured : move.captures) {
+            state.at(captured.y(), captured.x()) = { PlayerEnums::Unknown, 0 };
+        }
+        state.at(move.from.y(), move.from.x()) = { PlayerEnums::Unknown, 0 };
+        state.at(move.to.y(), move.to.x()) = { move.player, quint8(move.promotion ? 2 : piece.typeId) };
+    }
+
+    void unapply(State& state, const Move& move, Tracker* = nullptr) const override {
+        // La pièce revient sur sa case de départ, redevenue pion si elle a été promue
+        const quint8 typeId = move.promotion ? 1 : state.at(move.to.y(), move.to.x()).typeId;
+        state.at(move.to.y(), move.to.x()) = { PlayerEnums::Unknown, 0 };
+        state.at(move.from.y(), move.from.x()) = { move.player, typeId };
+
+        const PlayerEnums::PlayerPosition opponent = move.player == PlayerEnums::Player1 ? PlayerEnums::Player2 : PlayerEnums::Player1;
+        for (int i = 0; i < move.captures.size(); ++i) {
+            state.at(move.captures[i].y(), move.captures[i].x()) = { opponent, move.capturedTypes[i] };
+        }
     }
 
-    PlayerEnums::PlayerPosition checkWin(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState) const override {
+    PlayerEnums::PlayerPosition checkWin(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState, const Tracker* = nullptr) const override {
         bool player1Exists = false;
         bool player2Exists = false;
 
@@ -112,47 +130,199 @@ public:
         return PlayerEnums::Unknown;
     }
 
-    bool isGameOver(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState) const override {
+    bool isGameOver(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState, const Tracker* = nullptr) const override {
         return checkWin(gameState) != PlayerEnums::Unknown;
     }
 
+    // Génère tous les coups d'un joueur sur le plateau standard 8x8 (vide pour les autres tailles)
+    void generateMoves(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState, PlayerEnums::PlayerPosition playerPosition, CheckersBitboard::MoveList& moves) const {
+        moves.clear();
+        if (isStandardBoard(gameState)) {
+            CheckersBitboard::fromState(gameState).generateMoves(CheckersBitboard::sideOf(playerPosition), moves);
+        }
+    }
+
+    // Coups légaux : générateur bitboard sur le plateau standard, générateur générique sinon
+    void legalMoves(const State& state, PlayerEnums::PlayerPosition player, QVector<Move>& moves, const Tracker* = nullptr) const override {
+        if (!isStandardBoard(state)) {
+            generateBoardMoves(state, player, moves);
+            return;
+        }
+
+        moves.clear();
+        CheckersBitboard::MoveList generated;
+        CheckersBitboard::fromState(state).generateMoves(CheckersBitboard::sideOf(player), generated);
+        for (const CheckersBitboard::Move& bitMove : generated) {
+            Move move(QPoint(CheckersBitboard::colOf(bitMove.from), CheckersBitboard::rowOf(bitMove.from)),
+                      QPoint(CheckersBitboard::colOf(bitMove.to), CheckersBitboard::rowOf(bitMove.to)), player);
+            // Les prises choisissent la rafle quand deux rafles relient les mêmes cases
+            for (quint32 captures = bitMove.captures; captures; captures &= captures - 1) {
+                const int square = qCountTrailingZeroBits(captures);
+                move.captures.append(QPoint(CheckersBitboard::colOf(square), CheckersBitboard::rowOf(square)));
+            }
+            moves.append(move);
+        }
+    }
+
 private:
-    bool isSimpleMoveValid(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& state, int startRow, int startCol, int endRow, int endCol, Player *player) const {
-        int direction = (player->playerPosition() == PlayerEnums::Player1) ? 1 : -1;
+    // Plateau standard 8x8, celui du générateur bitboard
+    static bool isStandardBoard(const State& state) {
+        return state.rows() == 8 && state.cols() == 8;
+    }
 
-        // Vérifie les mouvements en diagonale d'une seule case
-        if (std::abs(endRow - startRow) == 1 && std::abs(endCol - startCol) == 1) {
-            if (state.at(endRow, endCol).position == PlayerEnums::Unknown &&
-                ((endRow - startRow) == direction || state.at(startRow, startCol).typeId == 2)) {
+    // Cherche le coup parmi les coups générés sur le plateau standard.
+    // Deux rafles peuvent relier les mêmes cases : si move.captures est renseigné, il choisit la rafle.
+    bool findStandardMove(const State& state, const Move& move, CheckersBitboard::Move& found) const {
+        const int from = CheckersBitboard::squareOf(move.from.y(), move.from.x());
+        const int to = CheckersBitboard::squareOf(move.to.y(), move.to.x());
+        if (from < 0 || to < 0) {
+            return false;
+        }
+
+        quint32 requestedCaptures = 0;
+        for (const QPoint& captured : move.captures) {
+            const int square = CheckersBitboard::squareOf(captured.y(), captured.x());
+            if (square < 0) {
+                return false;
+            }
+            requestedCaptures |= CheckersBitboard::bit(square);
+        }
+
+        CheckersBitboard::MoveList moves;
+        CheckersBitboard::fromState(state).generateMoves(CheckersBitboard::sideOf(move.player), moves);
+        for (const CheckersBitboard::Move& candidate : moves) {
+            if (candidate.from == from && candidate.to == to && (move.captures.isEmpty() || candidate.captures == requestedCaptures)) {
+                found = candidate;
                 return true;
             }
         }
         return false;
     }
 
-    bool isCaptureMoveValid(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& state, int startRow, int startCol, int endRow, int endCol, Player *player) const {
-        int direction = (player->playerPosition() == PlayerEnums::Player1) ? 1 : -1;
-
-        // Vérifie les captures en sautant une case
-        if (std::abs(endRow - startRow) == 2 && std::abs(endCol - startCol) == 2) {
-            int midRow = (startRow + endRow) / 2;
-            int midCol = (startCol + endCol) / 2;
-
-            if (state.at(midRow, midCol).position != PlayerEnums::Unknown &&
-                state.at(midRow, midCol).position != player->playerPosition() &&
-                state.at(endRow, endCol).position == PlayerEnums::Unknown &&
-                ((endRow - startRow) / 2 == direction || state.at(startRow, startCol).typeId == 2)) {
+    // Cherche le coup parmi les coups générés sur un plateau de taille quelconque (même choix de rafle que findStandardMove)
+    bool findBoardMove(const State& state, const Move& move, Move& found) const {
+        QVector<Move> moves;
+        generateBoardMoves(state, move.player, moves);
+        for (const Move& candidate : moves) {
+            if (candidate.from == move.from && candidate.to == move.to
+                && (move.captures.isEmpty() || sameSquares(candidate.captures, move.captures))) {
+                found = candidate;
                 return true;
             }
         }
         return false;
     }
 
-    void promoteToKing(QMatrix<AbstractStrategyRulesGame::AtomicCellState>& state, int row, int col, Player *player) const {
-        int lastRow = (player->playerPosition() == PlayerEnums::Player1) ? state.rows() - 1 : 0;
-        if (row == lastRow) {
-            state.at(row, col).typeId = 2; // Promotion en dame
+    // Génère les coups d'un joueur sur un plateau de taille quelconque.
+    // La prise est obligatoire : les déplacements simples ne sont générés que si aucune rafle n'existe.
+    void generateBoardMoves(const State& state, PlayerEnums::PlayerPosition player, QVector<Move>& moves) const {
+        moves.clear();
+        Move chain;
+        chain.player = player;
+        for (int row = 0; row < state.rows(); ++row) {
+            for (int col = 0; col < state.cols(); ++col) {
+                if (state.at(row, col).position == player) {
+                    chain.from = QPoint(col, row);
+                    collectChains(state, chain, chain.from, state.at(row, col).typeId == 2, moves);
+                }
+            }
+        }
+        if (!moves.isEmpty()) {
+            return;
+        }
+
+        const int forward = (player == PlayerEnums::Player1) ? 1 : -1;
+        const int lastRow = (player == PlayerEnums::Player1) ? state.rows() - 1 : 0;
+        for (int row = 0; row < state.rows(); ++row) {
+            for (int col = 0; col < state.cols(); ++col) {
+                const AbstractStrategyRulesGame::AtomicCellState piece = state.at(row, col);
+                if (piece.position != player) {
+                    continue;
+                }
+                for (int dRow : { 1, -1 }) {
+                    if (piece.typeId != 2 && dRow != forward) {
+                        continue; // Un pion n'avance que vers l'adversaire
+                    }
+                    for (int dCol : { 1, -1 }) {
+                        if (state.isValid(row + dRow, col + dCol) && state.at(row + dRow, col + dCol).position == PlayerEnums::Unknown) {
+                            Move step(QPoint(col, row), QPoint(col + dCol, row + dRow), player);
+                            step.promotion = piece.typeId != 2 && row + dRow == lastRow;
+                            moves.append(step);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Parcours en profondeur des rafles depuis la case current, sans copier le plateau :
+    // chain.captures sert de pile, les pièces prises restent sur le plateau jusqu'à la fin de la rafle
+    // (elles bloquent les cases d'arrivée et ne peuvent pas être prises deux fois).
+    void collectChains(const State& state, Move& chain, const QPoint& current, bool isKing, QVector<Move>& moves) const {
+        const int forward = (chain.player == PlayerEnums::Player1) ? 1 : -1;
+        const int lastRow = (chain.player == PlayerEnums::Player1) ? state.rows() - 1 : 0;
+
+        bool extended = false;
+        for (int dRow : { 1, -1 }) {
+            if (!isKing && dRow != forward) {
+                continue;
+            }
+            for (int dCol : { 1, -1 }) {
+                const QPoint over(current.x() + dCol, current.y() + dRow);
+                const QPoint landing(current.x() + 2 * dCol, current.y() + 2 * dRow);
+                if (!state.isValid(landing.y(), landing.x())) {
+                    continue;
+                }
+                const AbstractStrategyRulesGame::AtomicCellState jumped = state.at(over.y(), over.x());
+                if (jumped.position == PlayerEnums::Unknown || jumped.position == chain.player || chain.captures.contains(over)) {
+                    continue;
+                }
+                // La pièce qui joue a quitté sa case de départ
+                if (state.at(landing.y(), landing.x()).position != PlayerEnums::Unknown && landing != chain.from) {
+                    continue;
+                }
+
+                extended = true;
+                chain.captures.append(over);
+                chain.capturedTypes.append(jumped.typeId);
+                if (!isKing && landing.y() == lastRow) {
+                    appendChain(chain, landing, true, moves); // Un pion promu termine son coup
+                } else {
+                    collectChains(state, chain, landing, isKing, moves);
+                }
+                chain.captures.removeLast();
+                chain.capturedTypes.removeLast();
+            }
+        }
+
+        if (!extended && !chain.captures.isEmpty()) {
+            appendChain(chain, current, false, moves);
+        }
+    }
+
+    static void appendChain(const Move& chain, const QPoint& to, bool promotion, QVector<Move>& moves) {
+        // Une dame peut obtenir la même rafle dans des ordres différents : une seule est gardée
+        for (const Move& move : moves) {
+            if (move.from == chain.from && move.to == to && sameSquares(move.captures, chain.captures)) {
+                return;
+            }
+        }
+        Move move = chain;
+        move.to = to;
+        move.promotion = promotion;
+        moves.append(move);
+    }
+
+    static bool sameSquares(const Move::Captures& a, const Move::Captures& b) {
+        if (a.size() != b.size()) {
+            return false;
+        }
+        for (const QPoint& square : a) {
+            if (!b.contains(square)) {
+                return false;
+            }
         }
+        return true;
     }
 };
 
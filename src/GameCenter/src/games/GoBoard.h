@@ -0,0 +1,530 @@
+#ifndef GOBOARD_H
+#define GOBOARD_H
+
+#include "AbstractGame/AbstractStrategyRulesGame.h"
+#include "framework/types/ZobristTable.h"
+#include <QVector>
+#include <QtGlobal>
+#include <algorithm>
+#include <array>
+#include <utility>
+
+/**
+ * @class GoBoard
+ * @brief Incremental Go board tracking chains with union-find.
+ *
+ * The board is stored with a one-point border on every side, so the four
+ * neighbors of a point are always `p - 1`, `p + 1`, `p - stride` and
+ * `p + stride` without bounds checking.
+ *
+ * Each chain is a union-find set whose root holds the stone count and the
+ * pseudo-liberty count (empty neighbors counted once per adjacent stone).
+ * A chain is captured exactly when its pseudo-liberty count drops to zero.
+ * Stones of a chain are also linked in a circular list, so a capture only
+ * walks the captured stones. Placing a stone, merging, capturing and the
+ * suicide test therefore only touch the neighborhood of the move.
+ *
+ * The board also keeps a Zobrist hash of the stones, updated with one XOR per
+ * placed or captured stone. Boards up to 25x25 are hashed.
+ *
+ * When recording is enabled, every write of play() is logged with the
+ * previous value, so undo() takes a move back by replaying only what it
+ * changed. Recording also disables path halving, which would rewrite parents
+ * outside the log, so it is meant for search scopes where every move is
+ * undone again.
+ */
+class GoBoard {
+public:
+    static constexpr quint8 Empty = PlayerEnums::Unknown; ///< Empty point.
+    static constexpr quint8 Edge = 0xFF;                  ///< Border point outside the board.
+
+    static constexpr int MaxHashedPoints = 27 * 27;      ///< Bordered points of a 25x25 board.
+    using Zobrist = ZobristTable<MaxHashedPoints, PlayerEnums::Unknown>;
+
+    /**
+     * @brief Creates an empty board.
+     * @param rows Number of rows of the board.
+     * @param cols Number of columns of the board.
+     */
+    explicit GoBoard(int rows = 9, int cols = 9)
+        : rows_(rows)
+        , cols_(cols)
+        , stride_(cols + 2)
+        , cells_(stride_ * (rows + 2), Edge)
+        , parent_(cells_.size(), 0)
+        , next_(cells_.size(), 0)
+        , stones_(cells_.size(), 0)
+        , liberties_(cells_.size(), 0)
+        , hash_(0) {
+        for (int row = 0; row < rows_; ++row) {
+            for (int col = 0; col < cols_; ++col) {
+                cells_[point(row, col)] = Empty;
+            }
+        }
+    }
+
+    /**
+     * @brief Builds a board from a rules state in a single linear pass.
+     */
+    static GoBoard fromState(const QMatrix<AbstractStrategyRulesGame::AtomicCellState> &state) {
+        GoBoard board(state.rows(), state.cols());
+        for (int row = 0; row < board.rows_; ++row) {
+            for (int col = 0; col < board.cols_; ++col) {
+                const PlayerEnums::PlayerPosition stone = state.at(row, col).position;
+                if (stone != PlayerEnums::Unknown) {
+                    const int p = board.point(row, col);
+                    board.cells_[p] = stone;
+                    board.parent_[p] = p;
+                    board.next_[p] = p;
+                    board.stones_[p] = 1;
+                    board.toggleHash(p, stone);
+                }
+            }
+        }
+        for (int p = board.stride_; p < board.cells_.size() - board.stride_; ++p) {
+            if (!board.isStone(p)) {
+                continue;
+            }
+            // Join with the already visited neighbors of the same color
+            if (board.cells_[p - 1] == board.cells_[p]) {
+                board.merge(p - 1, p);
+            }
+            if (board.cells_[p - board.stride_] == board.cells_[p]) {
+                board.merge(p - board.stride_, p);
+            }
+            for (int n : board.neighbors(p)) {
+                if (board.cells_[n] == Empty) {
+                    ++board.liberties_[board.find(p)];
+                }
+            }
+        }
+        return board;
+    }
+
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+    int stride() const { return stride_; }
+
+    /**
+     * @brief Converts a board position into a point index.
+     */
+    int point(int row, int col) const { return (row + 1) * stride_ + col + 1; }
+    int rowOf(int p) const { return p / stride_ - 1; }
+    int colOf(int p) const { return p % stride_ - 1; }
+
+    /**
+     * @brief Returns the owner of a point (Unknown when empty).
+     */
+    PlayerEnums::PlayerPosition stoneAt(int p) const {
+        return isStone(p) ? static_cast<PlayerEnums::PlayerPosition>(cells_[p]) : PlayerEnums::Unknown;
+    }
+
+    bool isEmpty(int p) const { return cells_[p] == Empty; }
+
+    /**
+     * @brief Checks whether a point is on the board (not on the border).
+     */
+    bool isOnBoard(int p) const { return cells_[p] != Edge; }
+
+    /**
+     * @brief Number of point indexes, border included (valid indexes are 0 to pointCount() - 1).
+     */
+    int pointCount() const { return cells_.size(); }
+
+    /**
+     * @brief Zobrist hash of the stones on the board (0 for an empty or unhashed board).
+     */
+    quint64 hash() const { return hash_; }
+
+    /**
+     * @brief Checks whether the board is small enough to be hashed.
+     */
+    bool isHashed() const { return cells_.size() <= MaxHashedPoints; }
+
+    /**
+     * @brief Number of stones in the chain containing a point.
+     */
+    int chainSize(int p) const { return stones_[find(p)]; }
+
+    /**
+     * @brief Pseudo-liberty count of the chain containing a point (0 means no liberty).
+     */
+    int pseudoLiberties(int p) const { return liberties_[find(p)]; }
+
+    /**
+     * @brief Checks whether a stone can be played on an empty point.
+     *
+     * The move is legal if the point has an empty neighbor, captures an
+     * adjacent enemy chain, or connects to a friendly chain that keeps a
+     * liberty. Only the four neighbors are examined.
+     */
+    bool isLegal(int p, PlayerEnums::PlayerPosition color) const {
+        if (cells_[p] != Empty) {
+            return false;
+        }
+
+        const std::array<int, 4> around = neighbors(p);
+        int roots[4];
+        for (int i = 0; i < 4; ++i) {
+            const int n = around[i];
+            if (cells_[n] == Empty) {
+                return true;
+            }
+            roots[i] = isStone(n) ? find(n) : -1;
+        }
+
+        for (int i = 0; i < 4; ++i) {
+            if (roots[i] < 0) {
+                continue;
+            }
+            // Liberties of this chain that the new stone fills
+            int touching = 0;
+            for (int j = 0; j < 4; ++j) {
+                touching += roots[j] == roots[i] ? 1 : 0;
+            }
+            const bool friendly = cells_[around[i]] == color;
+            if (friendly ? liberties_[roots[i]] > touching : liberties_[roots[i]] == touching) {
+                return true;
+            }
+        }
+        return false; // Suicide
+    }
+
+    /**
+     * @brief Zobrist hash of the board after a legal stone, without playing it.
+     *
+     * Only the new stone and the enemy chains it captures change the hash, so
+     * the captured chains are walked and nothing else.
+     */
+    quint64 hashAfter(int p, PlayerEnums::PlayerPosition color) const {
+        if (!isHashed()) {
+            return hash_;
+        }
+
+        quint64 hash = hash_ ^ Zobrist::key(p, color);
+        const std::array<int, 4> around = neighbors(p);
+        int captured[4];
+        int capturedCount = 0;
+        for (int n : around) {
+            if (!isStone(n) || cells_[n] == color) {
+                continue;
+            }
+            const int root = find(n);
+            if (std::find(captured, captured + capturedCount, root) != captured + capturedCount) {
+                continue; // Chain already counted through another neighbor
+            }
+
+            // The chain is captured if the new stone fills all its pseudo-liberties
+            int touching = 0;
+            for (int m : around) {
+                touching += isStone(m) && find(m) == root ? 1 : 0;
+            }
+            if (liberties_[root] != touching) {
+                continue;
+            }
+            captured[capturedCount++] = root;
+            int stone = root;
+            do {
+                hash ^= Zobrist::key(stone, cells_[stone]);
+                stone = next_[stone];
+            } while (stone != root);
+        }
+        return hash;
+    }
+
+    /**
+     * @brief Plays a legal stone and removes the captured enemy chains.
+     *
+     * @param p The point to play, it must satisfy isLegal().
+     * @param color The color of the stone.
+     * @param captured If not null, receives the captured points.
+     * @return The number of captured stones.
+     */
+    int play(int p, PlayerEnums::PlayerPosition color, QVector<int> *captured = nullptr) {
+        Q_ASSERT(isLegal(p, color));
+
+        if (recording_) {
+            moves_.append({ p, trail_.size(), hash_ });
+        }
+        set(Cells, p, color);
+        set(Parent, p, p);
+        set(Next, p, p);
+        set(Stones, p, 1);
+        set(Liberties, p, 0);
+        toggleHash(p, color);
+
+        const std::array<int, 4> around = neighbors(p);
+        for (int n : around) {
+            if (cells_[n] == Empty) {
+                add(Liberties, p, 1);
+            } else if (isStone(n)) {
+                add(Liberties, find(n), -1); // The new stone fills one of its liberties
+            }
+        }
+
+        for (int n : around) {
+            if (cells_[n] == color) {
+                merge(n, p);
+            }
+        }
+
+        int removed = 0;
+        for (int n : around) {
+            if (isStone(n) && cells_[n] != color && liberties_[find(n)] == 0) {
+                removed += removeChain(n, captured);
+            }
+        }
+        return removed;
+    }
+
+    /**
+     * @brief Keeps an undo log of the next play() calls.
+     *
+     * Enabling or disabling the recording forgets the logged moves.
+     */
+    void setRecording(bool recording) {
+        recording_ = recording;
+        trail_.clear();
+        moves_.clear();
+    }
+
+    bool isRecording() const { return recording_; }
+
+    /**
+     * @brief Checks whether a recorded move can be taken back.
+     */
+    bool canUndo() const { return !moves_.isEmpty(); }
+
+    /**
+     * @brief Point of the last recorded move (-1 if none).
+     */
+    int lastMove() const { return moves_.isEmpty() ? -1 : moves_.last().point; }
+
+    /**
+     * @brief Takes back the last recorded move, captured stones included.
+     */
+    void undo() {
+        Q_ASSERT(canUndo());
+        const RecordedMove move = moves_.takeLast();
+        for (int i = trail_.size() - 1; i >= move.trailSize; --i) {
+            const Change &change = trail_.at(i);
+            write(change.field, change.index, change.value);
+        }
+        trail_.resize(move.trailSize);
+        hash_ = move.hash;
+    }
+
+    /**
+     * @brief Checks whether the board holds the stones of a rules state.
+     */
+    bool matches(const QMatrix<AbstractStrategyRulesGame::AtomicCellState> &state) const {
+        if (state.rows() != rows_ || state.cols() != cols_) {
+            return false;
+        }
+        for (int row = 0; row < rows_; ++row) {
+            for (int col = 0; col < cols_; ++col) {
+                if (stoneAt(point(row, col)) != state.at(row, col).position) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Number of empty points on the board.
+     */
+    int emptyCount() const {
+        int count = 0;
+        for (quint8 cell : cells_) {
+            count += cell == Empty ? 1 : 0;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Area score of the board: stones plus the empty regions bordered by a single color.
+     * @return Area of Player1 minus area of Player2, komi not included.
+     */
+    int areaScore() const {
+        int score = 0;
+        QVector<bool> visited(cells_.size(), false);
+        QVector<int> region;
+        for (int p = 0; p < cells_.size(); ++p) {
+            if (isStone(p)) {
+                score += cells_[p] == PlayerEnums::Player1 ? 1 : -1;
+                continue;
+            }
+            if (cells_[p] != Empty || visited[p]) {
+                continue;
+            }
+
+            // Flood fill the empty region and collect the colors around it
+            bool touchesPlayer1 = false;
+            bool touchesPlayer2 = false;
+            region.clear();
+            region.append(p);
+            visited[p] = true;
+            for (int i = 0; i < region.size(); ++i) {
+                for (int n : neighbors(region.at(i))) {
+                    if (cells_[n] == Empty && !visited[n]) {
+                        visited[n] = true;
+                        region.append(n);
+                    } else if (cells_[n] == PlayerEnums::Player1) {
+                        touchesPlayer1 = true;
+                    } else if (cells_[n] == PlayerEnums::Player2) {
+                        touchesPlayer2 = true;
+                    }
+                }
+            }
+            if (touchesPlayer1 != touchesPlayer2) {
+                score += touchesPlayer1 ? region.size() : -region.size();
+            }
+        }
+        return score;
+    }
+
+    /**
+     * @brief The four neighbors of a point (border points included).
+     */
+    std::array<int, 4> neighbors(int p) const { return { p - 1, p + 1, p - stride_, p + stride_ }; }
+
+private:
+    bool isStone(int p) const { return cells_[p] != Empty && cells_[p] != Edge; }
+
+    int find(int p) const {
+        while (parent_[p] != p) {
+            p = parent_[p];
+        }
+        return p;
+    }
+
+    int find(int p) {
+        while (parent_[p] != p) {
+            if (!recording_) {
+                parent_[p] = parent_[parent_[p]]; // Path halving
+            }
+            p = parent_[p];
+        }
+        return p;
+    }
+
+    void merge(int a, int b) {
+        int rootA = find(a);
+        int rootB = find(b);
+        if (rootA == rootB) {
+            return;
+        }
+        if (stones_[rootA] < stones_[rootB]) {
+            std::swap(rootA, rootB);
+        }
+        set(Parent, rootB, rootA);
+        add(Stones, rootA, stones_[rootB]);
+        add(Liberties, rootA, liberties_[rootB]);
+        // Splice the two circular stone lists
+        const int nextA = next_[rootA];
+        set(Next, rootA, next_[rootB]);
+        set(Next, rootB, nextA);
+    }
+
+    void toggleHash(int p, quint8 color) {
+        if (isHashed()) {
+            hash_ ^= Zobrist::key(p, color);
+        }
+    }
+
+    /**
+     * @brief Board array written by play(), named in the undo log.
+     */
+    enum Field : quint8 { Cells, Parent, Next, Stones, Liberties };
+
+    /**
+     * @brief Undo log entry: the value a slot held before a write.
+     */
+    struct Change {
+        Field field;
+        int index;
+        int value;
+    };
+
+    /**
+     * @brief Start of a recorded move in the undo log.
+     */
+    struct RecordedMove {
+        int point;     ///< Point the stone was played on.
+        int trailSize; ///< Size of the undo log before the move.
+        quint64 hash;  ///< Hash before the move.
+    };
+
+    int read(Field field, int index) const {
+        switch (field) {
+        case Cells: return cells_[index];
+        case Parent: return parent_[index];
+        case Next: return next_[index];
+        case Stones: return stones_[index];
+        case Liberties: return liberties_[index];
+        }
+        return 0;
+    }
+
+    void write(Field field, int index, int value) {
+        switch (field) {
+        case Cells: cells_[index] = static_cast<quint8>(value); break;
+        case Parent: parent_[index] = value; break;
+        case Next: next_[index] = value; break;
+        case Stones: stones_[index] = value; break;
+        case Liberties: liberties_[index] = value; break;
+        }
+    }
+
+    void set(Field field, int index, int value) {
+        if (recording_) {
+            trail_.append({ field, index, read(field, index) });
+        }
+        write(field, index, value);
+    }
+
+    void add(Field field, int index, int delta) { set(field, index, read(field, index) + delta); }
+
+    int removeChain(int p, QVector<int> *captured) {
+        const quint8 color = cells_[p];
+        int count = 0;
+        int stone = p;
+        do {
+            toggleHash(stone, color);
+            set(Cells, stone, Empty);
+            ++count;
+            stone = next_[stone];
+        } while (stone != p);
+
+        // Every removed stone gives a liberty back to the chains around it
+        stone = p;
+        do {
+            if (captured) {
+                captured->append(stone);
+            }
+            for (int n : neighbors(stone)) {
+                if (isStone(n)) {
+                    add(Liberties, find(n), 1);
+                }
+            }
+            stone = next_[stone];
+        } while (stone != p);
+        return count;
+    }
+
+    int rows_;                 ///< Number of rows.
+    int cols_;                 ///< Number of columns.
+    int stride_;               ///< Row stride including the border.
+    QVector<quint8> cells_;    ///< Point contents: PlayerPosition, Empty or Edge.
+    QVector<int> parent_;      ///< Union-find parent of each stone.
+    QVector<int> next_;        ///< Next stone of the same chain (circular list).
+    QVector<int> stones_;      ///< Stone count, valid at chain roots.
+    QVector<int> liberties_;   ///< Pseudo-liberty count, valid at chain roots.
+    quint64 hash_;             ///< Zobrist hash of the stones.
+    bool recording_ = false;   ///< Whether play() logs its writes for undo().
+    QVector<Change> trail_;    ///< Undo log of the recorded moves.
+    QVector<RecordedMove> moves_; ///< Recorded moves, oldest first.
+};
+
+#endif // GOBOARD_H
@@ -16,7 +16,7 @@ public:
     explicit GoGames(QObject* parent = nullptr);
 
 protected:
-    void updateVisuals() override;
+    void updateCell(int row, int col) override;
     void initializeGame() override;
 
 private:
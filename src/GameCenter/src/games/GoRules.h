@@ -3,16 +3,18 @@
 
 #include "AbstractGame/AbstractStrategyRulesGame.h"
 #include "framework/types/QMatrix.h"
-#include <stack>
-#include <set>
-#include <vector>
+#include "GoBoard.h"
 #include <QFile>
+#include <QSet>
+#include <optional>
 
 class GoRules : public AbstractStrategyRulesGame {
 public:
     explicit GoRules() = default;
     ~GoRules() override = default;
 
+    std::unique_ptr<AbstractStrategyRulesGame> clone() const override { return std::make_unique<GoRules>(*this); }
+
     // Retourne le nom du jeu
     QString gameName() const override { return QStringLiteral("Go"); }
 
@@ -30,53 +32,111 @@ public:
         return QMatrix<AbstractStrategyRulesGame::AtomicCellState>(gridX, gridY, { PlayerEnums::Unknown, 0 });
     }
 
-    bool isMoveValid(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& beforeState, QMatrix<AbstractStrategyRulesGame::AtomicCellState>& afterState, Player *player) override {
-        if (!validateMatrixDimensions(beforeState, afterState)) {
+    // Plateau incrémental suivi par le propriétaire de l'état ; reversible : journal d'annulation pour une recherche
+    std::unique_ptr<Tracker> track(const State& state, bool reversible = false) const override {
+        auto tracker = std::make_unique<GoTracker>();
+        tracker->board = GoBoard::fromState(state);
+        tracker->board.setRecording(reversible);
+        return tracker;
+    }
+
+    bool validate(const State& state, const Move& move, const Tracker* tracker = nullptr) const override {
+        // Une pierre posée sur une intersection vide
+        if (!move.isPlacement() || move.player == PlayerEnums::Unknown
+            || !state.isValid(move.to.y(), move.to.x()) || state.at(move.to.y(), move.to.x()).position != PlayerEnums::Unknown) {
             return false;
         }
 
-        int changes = 0;
-        int placedRow = -1;
-        int placedCol = -1;
-
-        for (int row = 0; row < beforeState.rows(); ++row) {
-            for (int col = 0; col < beforeState.cols(); ++col) {
-                if (beforeState.at(row, col).position != afterState.at(row, col).position) {
-                    // Vérifie qu'une seule case vide est jouée par le joueur
-                    if (beforeState.at(row, col).position != PlayerEnums::Unknown || afterState.at(row, col).position != player->playerPosition()) {
-                        return false; // Modification invalide
-                    }
-                    placedRow = row;
-                    placedCol = col;
-                    ++changes;
+        // Union-find des chaînes : captures et suicide ne regardent que les voisins du coup
+        std::optional<GoBoard> local;
+        const GoBoard& board = boardOf(state, tracker, local);
+        const int point = board.point(move.to.y(), move.to.x());
+        if (!board.isLegal(point, move.player)) {
+            return false; // Le mouvement placerait un groupe sans liberté (suicide)
+        }
+
+        // Superko positionnel : une position déjà vue dans la partie ne peut pas revenir
+        return !board.isHashed() || !positionHistory_.contains(board.hashAfter(point, move.player));
+    }
+
+    // Coups légaux en une passe sur le plateau, et le superko par hash incrémental
+    void legalMoves(const State& state, PlayerEnums::PlayerPosition player, QVector<Move>& moves,
+                    const Tracker* tracker = nullptr) const override {
+        moves.clear();
+        if (player == PlayerEnums::Unknown) {
+            return;
+        }
+
+        std::optional<GoBoard> local;
+        const GoBoard& board = boardOf(state, tracker, local);
+        const bool superko = board.isHashed() && !positionHistory_.isEmpty();
+        for (int row = 0; row < board.rows(); ++row) {
+            for (int col = 0; col < board.cols(); ++col) {
+                const int point = board.point(row, col);
+                if (!board.isLegal(point, player)) {
+                    continue;
                 }
+                if (superko && positionHistory_.contains(board.hashAfter(point, player))) {
+                    continue;
+                }
+                moves.append(Move::placement(QPoint(col, row), player));
             }
         }
+    }
 
-        if (changes != 1) return false; // Plus d'une modification détectée
-
-        // Simuler le placement pour vérifier les libertés
-        afterState.at(placedRow, placedCol).position = player->playerPosition();
+    void apply(State& state, Move& move, Tracker* tracker = nullptr) const override {
+        // Sans suivi, un plateau est construit pour ce coup seulement
+        GoTracker local;
+        GoTracker& tracked = tracker ? *static_cast<GoTracker*>(tracker) : local;
+        if (!tracker) {
+            local.board = GoBoard::fromState(state);
+        }
+        GoBoard& board = tracked.board;
+        Q_ASSERT(board.matches(state));
+
+        tracked.captured.clear();
+        board.play(board.point(move.to.y(), move.to.x()), move.player, &tracked.captured);
+
+        state.at(move.to.y(), move.to.x()) = { move.player, 0 };
+        move.captures.clear();
+        move.capturedTypes.clear();
+        for (int stone : tracked.captured) {
+            state.at(board.rowOf(stone), board.colOf(stone)) = { PlayerEnums::Unknown, 0 };
+            move.captures.append(QPoint(board.colOf(stone), board.rowOf(stone)));
+            move.capturedTypes.append(0);
+        }
+        move.promotion = false;
+    }
 
-        // Vérifier si le groupe du joueur placé a des libertés après capture des ennemis adjacents
-        QMatrix<AbstractStrategyRulesGame::AtomicCellState> simulatedState = afterState;
-        captureStones(simulatedState, player->playerPosition());
+    void unapply(State& state, const Move& move, Tracker* tracker = nullptr) const override {
+        // Les pierres capturées appartenaient forcément à l'adversaire
+        const PlayerEnums::PlayerPosition opponent = move.player == PlayerEnums::Player1 ? PlayerEnums::Player2 : PlayerEnums::Player1;
+        state.at(move.to.y(), move.to.x()) = { PlayerEnums::Unknown, 0 };
+        for (const QPoint& stone : move.captures) {
+            state.at(stone.y(), stone.x()) = { opponent, 0 };
+        }
 
-        QMatrix<bool> visited(simulatedState.rows(), simulatedState.cols(), false);
-        if (!hasLiberties(simulatedState, placedRow, placedCol, player->playerPosition(), visited)) {
-            return false; // Le mouvement placerait un groupe sans liberté (suicide)
+        if (!tracker) {
+            return;
         }
 
-        // Si valide, capturer les groupes adverses dans l'état final
-        captureStones(afterState, player->playerPosition());
-        return true;
+        // Une recherche reprend le dernier coup enregistré ; sinon le plateau est reconstruit depuis l'état
+        GoBoard& board = static_cast<GoTracker*>(tracker)->board;
+        if (board.canUndo() && board.lastMove() == board.point(move.to.y(), move.to.x())) {
+            board.undo();
+        } else {
+            const bool recording = board.isRecording();
+            board = GoBoard::fromState(state);
+            board.setRecording(recording);
+        }
+        Q_ASSERT(board.matches(state));
     }
 
-    PlayerEnums::PlayerPosition checkWin(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState) const override {
+    PlayerEnums::PlayerPosition checkWin(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState, const Tracker* = nullptr) const override {
         return Player().playerPosition(); // Simplification : aucun calcul des territoires
     }
 
-    bool isGameOver(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState) const override {
+    bool isGameOver(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState, const Tracker* = nullptr) const override {
         for (int row = 0; row < gameState.rows(); ++row) {
             for (int col = 0; col < gameState.cols(); ++col) {
                 if (gameState.at(row, col).position == PlayerEnums::Unknown) {
@@ -87,94 +147,47 @@ public:
         return true;
     }
 
-private:
-    bool validateMatrixDimensions(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& beforeState, const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& afterState) const {
-        return beforeState.rows() == afterState.rows() && beforeState.cols() == afterState.cols() && beforeState.rows() > 0;
+    void resetPositionHistory(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& initialState) override {
+        positionHistory_.clear();
+        recordPosition(initialState);
     }
 
-
-    void captureStones(QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState, PlayerEnums::PlayerPosition playerPosition) {
-        QMatrix<bool> visited(gameState.rows(), gameState.cols(), false);
-
-        for (int row = 0; row < gameState.rows(); ++row) {
-            for (int col = 0; col < gameState.cols(); ++col) {
-                PlayerEnums::PlayerPosition stone = gameState.at(row, col).position;
-                if (stone != PlayerEnums::Unknown && stone != playerPosition && !visited.at(row, col)) {
-                    if (!hasLiberties(gameState, row, col, stone, visited)) {
-                        removeGroup(gameState, row, col, stone);
-                    }
-                }
-            }
-        }
+    // Avec un suivi, le hash est déjà à jour : un XOR par pierre posée ou prise dans GoBoard::play()
+    void recordPosition(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState, const Tracker* tracker = nullptr) override {
+        positionHistory_.insert(hashOf(gameState, tracker));
     }
 
+    // Le superko garantit que chaque position n'a été ajoutée qu'une fois
+    void forgetPosition(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState, const Tracker* tracker = nullptr) override {
+        positionHistory_.remove(hashOf(gameState, tracker));
+    }
 
-    bool hasLiberties(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState, int startRow, int startCol, PlayerEnums::PlayerPosition stone, QMatrix<bool>& visited) const {
-        std::stack<std::pair<int, int>> positions;
-        positions.push({startRow, startCol});
-
-        while (!positions.empty()) {
-            auto [row, col] = positions.top();
-            positions.pop();
-
-            if (!gameState.isValid(row, col) || visited.at(row, col)) {
-                continue;
-            }
-            visited.at(row, col) = true;
-
-            if (gameState.at(row, col).position == PlayerEnums::Unknown) {
-                return true; // Liberté trouvée
-            }
-
-            if (gameState.at(row, col).position != stone) {
-                continue;
-            }
-
-            // Parcourir les voisins
-            static const std::vector<std::pair<int, int>> directions = {
-                {0, -1}, {0, 1}, {-1, 0}, {1, 0}
-            };
+    // Clés Zobrist des positions déjà jouées, réutilisables comme clés de table de transposition
+    const QSet<quint64>& positionHistory() const { return positionHistory_; }
 
-            for (const auto& [dx, dy] : directions) {
-                int newRow = row + dx;
-                int newCol = col + dy;
-                if (gameState.isValid(newRow, newCol) && !visited.at(newRow, newCol)) {
-                    positions.push({newRow, newCol});
-                }
-            }
+private:
+    // Plateau union-find d'un état, appartenant au propriétaire de cet état
+    struct GoTracker : Tracker {
+        GoBoard board;
+        QVector<int> captured; ///< Tampon des pierres prises par apply().
+    };
+
+    // Le plateau suivi de l'état, ou à défaut un plateau construit pour cet appel dans local
+    static const GoBoard& boardOf(const State& state, const Tracker* tracker, std::optional<GoBoard>& local) {
+        if (tracker) {
+            const GoBoard& board = static_cast<const GoTracker*>(tracker)->board;
+            Q_ASSERT(board.matches(state));
+            return board;
         }
-
-        return false; // Pas de libertés trouvées
+        return local.emplace(GoBoard::fromState(state));
     }
 
-    void removeGroup(QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState, int startRow, int startCol, PlayerEnums::PlayerPosition stone) {
-        std::stack<std::pair<int, int>> positions;
-        positions.push({startRow, startCol});
-
-        while (!positions.empty()) {
-            auto [row, col] = positions.top();
-            positions.pop();
-
-            if (!gameState.isValid(row, col) || gameState.at(row, col).position != stone) {
-                continue;
-            }
-
-            gameState.at(row, col).position = PlayerEnums::Unknown; // Supprimer la pierre
-
-            // Directions pour parcourir les voisins
-            static const std::vector<std::pair<int, int>> directions = {
-                {0, -1}, {0, 1}, {-1, 0}, {1, 0}
-            };
-
-            for (const auto& [dx, dy] : directions) {
-                int newRow = row + dx;
-                int newCol = col + dy;
-                if (gameState.isValid(newRow, newCol) && gameState.at(newRow, newCol).position == stone) {
-                    positions.push({newRow, newCol});
-                }
-            }
-        }
+    static quint64 hashOf(const State& state, const Tracker* tracker) {
+        std::optional<GoBoard> local;
+        return boardOf(state, tracker, local).hash();
     }
+
+    QSet<quint64> positionHistory_; ///< Positions (hash Zobrist) rencontrées depuis le début de la partie.
 };
 
 #endif // GORULES_H
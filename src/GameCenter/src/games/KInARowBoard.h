@@ -0,0 +1,176 @@
+#ifndef KINAROWBOARD_H
+#define KINAROWBOARD_H
+
+#include "AbstractGame/AbstractStrategyRulesGame.h"
+#include <QtGlobal>
+#include <QtAlgorithms>
+#include <QVector>
+#include <array>
+
+/**
+ * @class KInARowMask
+ * @brief A 256-bit set of board cells, one bit per cell in row-major order.
+ *
+ * Large enough for any board up to 16x16 (15x15 gomoku included).
+ */
+class KInARowMask {
+public:
+    static constexpr int MaxCells = 256;
+
+    void set(int cell) { words_[cell >> 6] |= quint64(1) << (cell & 63); }
+    void reset(int cell) { words_[cell >> 6] &= ~(quint64(1) << (cell & 63)); }
+    bool test(int cell) const { return (words_[cell >> 6] >> (cell & 63)) & 1; }
+
+    /**
+     * @brief Checks whether every cell of `mask` is also set in this set.
+     */
+    bool contains(const KInARowMask &mask) const {
+        return ((words_[0] & mask.words_[0]) == mask.words_[0])
+            && ((words_[1] & mask.words_[1]) == mask.words_[1])
+            && ((words_[2] & mask.words_[2]) == mask.words_[2])
+            && ((words_[3] & mask.words_[3]) == mask.words_[3]);
+    }
+
+    int count() const {
+        return qPopulationCount(words_[0]) + qPopulationCount(words_[1])
+             + qPopulationCount(words_[2]) + qPopulationCount(words_[3]);
+    }
+
+    /**
+     * @brief Counts the cells of `mask` that are also set in this set.
+     */
+    int countIn(const KInARowMask &mask) const {
+        return qPopulationCount(words_[0] & mask.words_[0]) + qPopulationCount(words_[1] & mask.words_[1])
+             + qPopulationCount(words_[2] & mask.words_[2]) + qPopulationCount(words_[3] & mask.words_[3]);
+    }
+
+private:
+    std::array<quint64, 4> words_ {};
+};
+
+/**
+ * @class KInARowLines
+ * @brief Precomputed winning lines of a k-in-a-row game on an NxM board.
+ *
+ * Every horizontal, vertical and diagonal segment of `winLength` cells is
+ * stored as a mask, so testing a win is a few AND/compare per line. Lines are
+ * also indexed by cell, so the win created by a single move only tests the
+ * at most 4 * winLength lines going through that cell.
+ */
+class KInARowLines {
+public:
+    /**
+     * @brief Builds the line table.
+     * @param rows Number of rows of the board.
+     * @param cols Number of columns of the board.
+     * @param winLength Number of aligned stones needed to win.
+     */
+    KInARowLines(int rows, int cols, int winLength)
+        : rows_(rows), cols_(cols), winLength_(winLength) {
+        if (!isSupported()) {
+            return;
+        }
+
+        static const int directions[4][2] = { {0, 1}, {1, 0}, {1, 1}, {1, -1} };
+        QVector<QVector<int>> linesByCell(rows_ * cols_);
+        for (int row = 0; row < rows_; ++row) {
+            for (int col = 0; col < cols_; ++col) {
+                for (const auto &direction : directions) {
+                    const int lastRow = row + direction[0] * (winLength_ - 1);
+                    const int lastCol = col + direction[1] * (winLength_ - 1);
+                    if (lastRow < 0 || lastRow >= rows_ || lastCol < 0 || lastCol >= cols_) {
+                        continue;
+                    }
+                    KInARowMask line;
+                    for (int i = 0; i < winLength_; ++i) {
+                        const int cell = (row + direction[0] * i) * cols_ + col + direction[1] * i;
+                        line.set(cell);
+                        linesByCell[cell].append(lines_.size());
+                    }
+                    lines_.append(line);
+                }
+            }
+        }
+
+        // Flatten the per-cell index into one buffer
+        cellOffsets_.reserve(rows_ * cols_ + 1);
+        for (const QVector<int> &lines : linesByCell) {
+            cellOffsets_.append(cellLines_.size());
+            cellLines_.append(lines);
+        }
+        cellOffsets_.append(cellLines_.size());
+    }
+
+    /**
+     * @brief Checks that the board fits in a KInARowMask and the line length is playable.
+     */
+    bool isSupported() const {
+        return rows_ > 0 && cols_ > 0 && rows_ * cols_ <= KInARowMask::MaxCells
+            && winLength_ > 0 && winLength_ <= qMax(rows_, cols_);
+    }
+
+    /**
+     * @brief Checks whether a state has the dimensions this table was built for.
+     */
+    bool matches(const QMatrix<AbstractStrategyRulesGame::AtomicCellState> &state) const {
+        return isSupported() && state.rows() == rows_ && state.cols() == cols_;
+    }
+
+    /**
+     * @brief Checks whether a set of stones covers any winning line.
+     */
+    bool isWinning(const KInARowMask &stones) const {
+        for (const KInARowMask &line : lines_) {
+            if (stones.contains(line)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Checks whether a set of stones covers a winning line through a cell.
+     */
+    bool isWinningAt(const KInARowMask &stones, int cell) const {
+        for (int i = cellOffsets_[cell]; i < cellOffsets_[cell + 1]; ++i) {
+            if (stones.contains(lines_[cellLines_[i]])) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Splits a rules state into one stone mask per player.
+     * @param state The state to read, it must match the table.
+     * @param player1 Receives the cells of Player1.
+     * @param player2 Receives the cells of Player2.
+     */
+    static void split(const QMatrix<AbstractStrategyRulesGame::AtomicCellState> &state, KInARowMask &player1, KInARowMask &player2) {
+        const AbstractStrategyRulesGame::AtomicCellState *cells = state.data();
+        for (int cell = 0; cell < state.size(); ++cell) {
+            if (cells[cell].position == PlayerEnums::Player1) {
+                player1.set(cell);
+            } else if (cells[cell].position == PlayerEnums::Player2) {
+                player2.set(cell);
+            }
+        }
+    }
+
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+    int winLength() const { return winLength_; }
+
+    int lineCount() const { return lines_.size(); }
+    const KInARowMask &line(int index) const { return lines_[index]; }
+
+private:
+    int rows_;
+    int cols_;
+    int winLength_;
+    QVector<KInARowMask> lines_;  ///< Every winning segment.
+    QVector<int> cellLines_;      ///< Line indexes grouped by cell.
+    QVector<int> cellOffsets_;    ///< Start of each cell's group in cellLines_.
+};
+
+#endif // KINAROWBOARD_H
@@ -0,0 +1,80 @@
+#ifndef RULESCATALOG_H
+#define RULESCATALOG_H
+
+#include <QList>
+#include <QSize>
+#include <QString>
+#include <functional>
+#include <memory>
+
+#include "games/TicTacToeRules.h"
+#include "games/GoRules.h"
+#include "games/CheckersRules.h"
+
+// Typedef pour les constructeurs de règles, sans scène
+using RulesFactory = std::function<std::unique_ptr<AbstractStrategyRulesGame>()>;
+
+/**
+ * @class RulesCatalog
+ * @brief Lists the games that can be played without a scene: their rules and board size.
+ *
+ * Only depends on Qt Core, so headless tools (tournament, benchmarks) use it
+ * without the widgets. GameCatalogModel pairs each entry with its scene.
+ */
+class RulesCatalog {
+public:
+    RulesCatalog() {
+        initializeGames();
+    }
+
+    /**
+     * @brief Gets the number of games in the catalog.
+     */
+    int size() const { return m_games.size(); }
+
+    /**
+     * @brief Finds a game by name.
+     * @param name The display name of the game.
+     * @return The row of the game, or -1 if it is not in the catalog.
+     */
+    int indexOf(const QString &name) const {
+        for (int row = 0; row < m_games.size(); ++row) {
+            if (m_games[row].name == name)
+                return row;
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Gets the name of a game.
+     */
+    QString name(int row) const { return m_games.at(row).name; }
+
+    /**
+     * @brief Gets the rules factory of a game.
+     */
+    RulesFactory rulesFactory(int row) const { return m_games.at(row).rules; }
+
+    /**
+     * @brief Gets the board size of a game (columns x rows).
+     */
+    QSize boardSize(int row) const { return m_games.at(row).boardSize; }
+
+private:
+    struct Game {
+        QString name;
+        RulesFactory rules;
+        QSize boardSize;
+    };
+
+    QList<Game> m_games;
+
+    void initializeGames() {
+        m_games.append({"Go", []() { return std::make_unique<GoRules>(); }, QSize(9, 9)});
+        m_games.append({"Tic Tac Toe", []() { return std::make_unique<TicTacToeRules>(); }, QSize(4, 4)});
+        m_games.append({"Gomoku", []() { return std::make_unique<TicTacToeRules>(15, 15, 5); }, QSize(15, 15)});
+        m_games.append({"Checkers", []() { return std::make_unique<CheckersRules>(); }, QSize(8, 8)});
+    }
+};
+
+#endif // RULESCATALOG_H
@@ -7,11 +7,12 @@
 // Constructor
 // --------------------------------------------
 
-TicTacToeGames::TicTacToeGames(QObject* parent)
+TicTacToeGames::TicTacToeGames(QObject* parent, const QSize& gridSize, int winLength)
     : AbstractTableGame(parent)
-    , gridSize_(QSize(4, 4)) // Default grid size for Tic-Tac-Toe
+    , gridSize_(gridSize) // 4x4 by default for Tic-Tac-Toe
 {
-    rulesOfTheGame_ = new TicTacToeRules();
+    installRules(new TicTacToeRules(gridSize_.height(), gridSize_.width(), winLength));
+    setBoardGeometry(QPointF(0, 0), QSizeF(100, 100)); // Cells drawn by drawGrid()
     drawGrid(); // Initial drawing of the grid
 }
 
@@ -21,17 +22,10 @@ TicTacToeGames::TicTacToeGames(QObject* parent)
 
 void TicTacToeGames::initializeGame()
 {
-    // Remove all existing graphical elements
-    for (int row = 0; row < cells_.rows(); ++row) {
-        for (int col = 0; col < cells_.cols(); ++col) {
-            if (cells_.at(row, col)) {
-                removeItem(cells_.at(row, col)); // Remove each cell
-            }
-        }
+    // The grid is drawn once, startGame() removes the symbols of the previous game
+    if (cells_.rows() != gridSize_.height() || cells_.cols() != gridSize_.width()) {
+        drawGrid();
     }
-    cells_.clear(nullptr);
-    clear();        // Clear the scene
-    drawGrid();     // Draw the grid again
 }
 
 void TicTacToeGames::drawGrid()
@@ -58,36 +52,37 @@ void TicTacToeGames::drawGrid()
 QString TicTacToeGames::playerToString(PlayerEnums::PlayerPosition player) const
 {
     // Return "X" for the first player and "O" for the second
-    return (players_.at(0)->playerPosition() == player) ? "X" : "O";
+    return (session_.players().at(0)->playerPosition() == player) ? "X" : "O";
 }
 
 // --------------------------------------------
 // Update Visuals
 // --------------------------------------------
 
-void TicTacToeGames::updateVisuals()
+void TicTacToeGames::updateCell(int row, int col)
 {
-    // Remove all existing graphical elements
-    initializeGame();
-
-    // Add symbols to represent the current game state
-    for (int row = 0; row < gameState_.rows(); ++row) {
-        for (int col = 0; col < gameState_.cols(); ++col) {
-            PlayerEnums::PlayerPosition currentPlayer = gameState_.at(row, col).position;
-            if (currentPlayer != PlayerEnums::Unknown) {
-                // Create a text item for the player's symbol
-                QString symbol = playerToString(currentPlayer);
-                QGraphicsTextItem* text = addText(symbol, QFont("Arial", 36));
-
-                // Set the text color based on the player
-                text->setDefaultTextColor((currentPlayer == players_.at(0)->playerPosition()) ? Qt::black : Qt::red);
+    PlayerEnums::PlayerPosition currentPlayer = getGameState().at(row, col).position;
+    QAbstractGraphicsShapeItem*& symbol = pieceItems_.at(row, col);
 
-                // Position the text within the corresponding cell
-                QGraphicsRectItem* cell = cells_.at(row, col);
-                if (cell) {
-                    text->setPos(cell->rect().x() + 30, cell->rect().y() + 20);
-                }
-            }
+    // An undone move empties its cell
+    if (currentPlayer == PlayerEnums::Unknown) {
+        if (symbol) {
+            removeItem(symbol);
+            delete symbol;
+            symbol = nullptr;
         }
+        return;
     }
+
+    if (symbol == nullptr) {
+        // Create a text item for the player's symbol, positioned within the corresponding cell
+        QGraphicsSimpleTextItem* text = addSimpleText(playerToString(currentPlayer), QFont("Arial", 36));
+        text->setPos(cells_.at(row, col)->rect().x() + 30, cells_.at(row, col)->rect().y() + 20);
+        symbol = text;
+    } else {
+        static_cast<QGraphicsSimpleTextItem*>(symbol)->setText(playerToString(currentPlayer));
+    }
+
+    // Set the text color based on the player
+    symbol->setBrush((currentPlayer == session_.players().at(0)->playerPosition()) ? Qt::black : Qt::red);
 }
@@ -13,10 +13,15 @@ class TicTacToeGames : public AbstractTableGame
     Q_OBJECT
 
 public:
-    explicit TicTacToeGames(QObject* parent = nullptr);
+    /**
+     * @param parent Parent object.
+     * @param gridSize Board dimensions.
+     * @param winLength Aligned symbols needed to win, 0 for a complete line (15x15 with 5 gives gomoku).
+     */
+    explicit TicTacToeGames(QObject* parent = nullptr, const QSize& gridSize = QSize(4, 4), int winLength = 0);
 
 protected:
-    void updateVisuals() override;
+    void updateCell(int row, int col) override;
     void initializeGame() override;
 
 private:
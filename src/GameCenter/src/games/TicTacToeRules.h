@@ -3,15 +3,23 @@
 
 #include "AbstractGame/AbstractStrategyRulesGame.h"
 #include "AbstractGame/Player.h"
+#include "KInARowBoard.h"
 #include <QFile>
+#include <algorithm>
 
 class TicTacToeRules : public AbstractStrategyRulesGame {
 public:
-    explicit TicTacToeRules() = default;
+    // winLength = 0 : il faut aligner une ligne complète du plateau
+    explicit TicTacToeRules(int rows = 4, int cols = 4, int winLength = 0)
+        : lines_(rows, cols, winLength > 0 ? winLength : qMax(rows, cols)), winLength_(winLength) {}
     ~TicTacToeRules() override = default;
 
+    std::unique_ptr<AbstractStrategyRulesGame> clone() const override { return std::make_unique<TicTacToeRules>(*this); }
+
     // Retourne le nom du jeu
-    QString gameName() const override { return QStringLiteral("TicTacToe"); }
+    QString gameName() const override {
+        return lines_.winLength() < qMax(lines_.rows(), lines_.cols()) ? QStringLiteral("Gomoku") : QStringLiteral("TicTacToe");
+    }
 
     // Retourne les règles du jeu
     QString gameRules() const override {
@@ -33,138 +41,184 @@ public:
         return QMatrix<AbstractStrategyRulesGame::AtomicCellState>(gridX, gridY, { PlayerEnums::Unknown, 0 });
     }
 
-    // Validate a player's move
-    bool isMoveValid(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& beforeState,
-                     QMatrix<AbstractStrategyRulesGame::AtomicCellState>& afterState,
-                     Player *player) override {
-        // Ensure the dimensions match
-        if (beforeState.rows() != afterState.rows() || beforeState.cols() != afterState.cols()) {
-            return false;
-        }
-
-        int changes = 0;
-        for (int row = 0; row < beforeState.rows(); ++row) {
-            for (int col = 0; col < beforeState.cols(); ++col) {
-                if (beforeState.at(row, col).position != afterState.at(row, col).position) {
-                    // Ensure the move involves only one empty cell
-                    if (beforeState.at(row, col).position != PlayerEnums::Unknown ||
-                        afterState.at(row, col).position != player->playerPosition()) {
-                        return false; // Invalid move
-                    }
-                    ++changes;
+    // Validate a player's move: one mark on an empty cell
+    bool validate(const State& state, const Move& move, const Tracker* = nullptr) const override {
+        return move.isPlacement()
+            && move.player != PlayerEnums::Unknown
+            && state.isValid(move.to.y(), move.to.x())
+            && state.at(move.to.y(), move.to.x()).position == PlayerEnums::Unknown;
+    }
+
+    // Legal moves: one mark on any empty cell
+    void legalMoves(const State& state, PlayerEnums::PlayerPosition player, QVector<Move>& moves, const Tracker* = nullptr) const override {
+        moves.clear();
+        if (player == PlayerEnums::Unknown) {
+            return;
+        }
+        for (int row = 0; row < state.rows(); ++row) {
+            for (int col = 0; col < state.cols(); ++col) {
+                if (state.at(row, col).position == PlayerEnums::Unknown) {
+                    moves.append(Move::placement(QPoint(col, row), player));
                 }
             }
         }
+    }
 
-        return changes == 1; // Exactly one cell should change
+    // Stone masks of a state for its owner, kept in step move by move by apply() and unapply()
+    std::unique_ptr<Tracker> track(const State& state, bool reversible = false) const override {
+        Q_UNUSED(reversible) // Taking a mark back only clears its bit
+        if (!lines_.matches(state)) {
+            return nullptr; // The scan does not need any data
+        }
+        auto tracker = std::make_unique<KInARowTracker>();
+        KInARowLines::split(state, tracker->player1, tracker->player2);
+        tracker->marks = tracker->player1.count() + tracker->player2.count();
+        tracker->winner = winnerOf(tracker->player1, tracker->player2);
+        return tracker;
     }
 
-    // Check if there's a winner
-    PlayerEnums::PlayerPosition checkWin(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState) const override {
-        int gridSize = gameState.rows(); // Grid is square, rows == cols
-
-        // Check rows
-        for (int row = 0; row < gridSize; ++row) {
-            PlayerEnums::PlayerPosition firstPlayer = gameState.at(row, 0).position;
-            if (firstPlayer != PlayerEnums::Unknown) {
-                bool rowWin = true;
-                for (int col = 1; col < gridSize; ++col) {
-                    if (gameState.at(row, col).position != firstPlayer) {
-                        rowWin = false;
-                        break;
-                    }
-                }
-                if (rowWin) {
-                    return firstPlayer; // Winner in this row
-                }
-            }
+    // Apply a validated move, the tracked masks only test the lines through the new mark
+    void apply(State& state, Move& move, Tracker* tracker = nullptr) const override {
+        state.at(move.to.y(), move.to.x()) = { move.player, 0 };
+        if (!tracker) {
+            return;
         }
 
-        // Check columns
-        for (int col = 0; col < gridSize; ++col) {
-            PlayerEnums::PlayerPosition firstPlayer = gameState.at(0, col).position;
-            if (firstPlayer != PlayerEnums::Unknown) {
-                bool colWin = true;
-                for (int row = 1; row < gridSize; ++row) {
-                    if (gameState.at(row, col).position != firstPlayer) {
-                        colWin = false;
-                        break;
-                    }
-                }
-                if (colWin) {
-                    return firstPlayer; // Winner in this column
-                }
-            }
+        KInARowTracker& tracked = *static_cast<KInARowTracker*>(tracker);
+        const int cell = move.to.y() * lines_.cols() + move.to.x();
+        KInARowMask& stones = tracked.stonesOf(move.player);
+        stones.set(cell);
+        ++tracked.marks;
+        if (tracked.winner == PlayerEnums::Unknown && lines_.isWinningAt(stones, cell)) {
+            tracked.winner = move.player;
         }
+    }
 
-        // Check main diagonal
-        PlayerEnums::PlayerPosition mainDiagonalPlayer = gameState.at(0, 0).position;
-        if (mainDiagonalPlayer != PlayerEnums::Unknown) {
-            bool mainDiagonalWin = true;
-            for (int i = 1; i < gridSize; ++i) {
-                if (gameState.at(i, i).position != mainDiagonalPlayer) {
-                    mainDiagonalWin = false;
-                    break;
-                }
-            }
-            if (mainDiagonalWin) {
-                return mainDiagonalPlayer; // Winner in main diagonal
-            }
+    // Revert an applied move
+    void unapply(State& state, const Move& move, Tracker* tracker = nullptr) const override {
+        state.at(move.to.y(), move.to.x()) = { PlayerEnums::Unknown, 0 };
+        if (!tracker) {
+            return;
         }
 
-        // Check secondary diagonal
-        PlayerEnums::PlayerPosition secondaryDiagonalPlayer = gameState.at(0, gridSize - 1).position;
-        if (secondaryDiagonalPlayer != PlayerEnums::Unknown) {
-            bool secondaryDiagonalWin = true;
-            for (int i = 1; i < gridSize; ++i) {
-                if (gameState.at(i, gridSize - 1 - i).position != secondaryDiagonalPlayer) {
-                    secondaryDiagonalWin = false;
-                    break;
-                }
-            }
-            if (secondaryDiagonalWin) {
-                return secondaryDiagonalPlayer; // Winner in secondary diagonal
-            }
+        KInARowTracker& tracked = *static_cast<KInARowTracker*>(tracker);
+        tracked.stonesOf(move.player).reset(move.to.y() * lines_.cols() + move.to.x());
+        --tracked.marks;
+        if (tracked.winner != PlayerEnums::Unknown) {
+            // Only a winning position pays for a full line test
+            tracked.winner = winnerOf(tracked.player1, tracked.player2);
         }
+    }
 
-        // No winner
-        return PlayerEnums::Unknown;
+    // Check if there's a winner
+    PlayerEnums::PlayerPosition checkWin(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState,
+                                         const Tracker* tracker = nullptr) const override {
+        if (tracker) {
+            return static_cast<const KInARowTracker*>(tracker)->winner;
+        }
+        if (!lines_.matches(gameState)) {
+            return checkWinByScan(gameState);
+        }
+
+        // One pass to build the stone masks, then a few AND/compare per winning line
+        KInARowMask player1;
+        KInARowMask player2;
+        KInARowLines::split(gameState, player1, player2);
+        return winnerOf(player1, player2);
     }
 
+    // Winning lines of the board this rules instance was built for
+    const KInARowLines& lines() const { return lines_; }
+
     // Check if the game is over
-    bool isGameOver(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState) const override {
-        // Check if a player has already won
-        if (checkWin(gameState) != PlayerEnums::Unknown) {
+    bool isGameOver(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState, const Tracker* tracker = nullptr) const override {
+        if (tracker) {
+            const KInARowTracker& tracked = *static_cast<const KInARowTracker*>(tracker);
+            return tracked.winner != PlayerEnums::Unknown || tracked.marks == gameState.size();
+        }
+        if (!lines_.matches(gameState)) {
+            return checkWinByScan(gameState) != PlayerEnums::Unknown || hasNoEmptyCell(gameState);
+        }
+
+        KInARowMask player1;
+        KInARowMask player2;
+        KInARowLines::split(gameState, player1, player2);
+        if (lines_.isWinning(player1) || lines_.isWinning(player2)) {
             return true;
         }
 
-        // Track whether there are any empty cells
-        bool hasEmptyCells = false;
+        // Without a winner, the game ends when the board is full
+        return player1.count() + player2.count() == gameState.size();
+    }
+
+private:
+    KInARowLines lines_; ///< Winning lines for the board size this rules instance was built for.
+    int winLength_;      ///< Requested line length, 0 for a full line of the board.
 
-        // Iterate over the game state
-        for (int row = 0; row < gameState.rows(); ++row) {
-            for (int col = 0; col < gameState.cols(); ++col) {
-                if (gameState.at(row, col).position == PlayerEnums::Unknown) {
-                    hasEmptyCells = true;
+    // Stone masks of a state, owned with that state by a session or a search
+    struct KInARowTracker : Tracker {
+        KInARowMask player1;
+        KInARowMask player2;
+        int marks = 0;                                          ///< Number of marks of both players.
+        PlayerEnums::PlayerPosition winner = PlayerEnums::Unknown; ///< First player to complete a line.
 
-                    // Simulate moves for both players at this empty cell
-                    for (auto player : {PlayerEnums::Player1, PlayerEnums::Player2}) {
-                        QMatrix<AbstractStrategyRulesGame::AtomicCellState> simulatedState = gameState;
-                        simulatedState.at(row, col).position = player;
+        KInARowMask& stonesOf(PlayerEnums::PlayerPosition player) {
+            return player == PlayerEnums::Player1 ? player1 : player2;
+        }
+    };
 
-                        // If this move leads to a win for any player, game is not over
-                        if (checkWin(simulatedState) == player) {
-                            return false; // A player can still win
-                        }
+    PlayerEnums::PlayerPosition winnerOf(const KInARowMask& player1, const KInARowMask& player2) const {
+        if (lines_.isWinning(player1)) {
+            return PlayerEnums::Player1;
+        }
+        if (lines_.isWinning(player2)) {
+            return PlayerEnums::Player2;
+        }
+        return PlayerEnums::Unknown;
+    }
+
+    bool hasNoEmptyCell(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState) const {
+        const AbstractStrategyRulesGame::AtomicCellState* cells = gameState.data();
+        return std::none_of(cells, cells + gameState.size(), [](const AbstractStrategyRulesGame::AtomicCellState& cell) {
+            return cell.position == PlayerEnums::Unknown;
+        });
+    }
+
+    // Scan for runs of winLength marks, used when the line masks do not cover the board
+    // (more than KInARowMask::MaxCells cells, or another size than lines_)
+    PlayerEnums::PlayerPosition checkWinByScan(const QMatrix<AbstractStrategyRulesGame::AtomicCellState>& gameState) const {
+        const int rows = gameState.rows();
+        const int cols = gameState.cols();
+        const int length = winLength_ > 0 ? winLength_ : qMax(rows, cols);
+        static const int directions[4][2] = { {0, 1}, {1, 0}, {1, 1}, {1, -1} };
+
+        for (int row = 0; row < rows; ++row) {
+            for (int col = 0; col < cols; ++col) {
+                const PlayerEnums::PlayerPosition player = gameState.at(row, col).position;
+                if (player == PlayerEnums::Unknown) {
+                    continue;
+                }
+                for (const auto& direction : directions) {
+                    // Runs that would leave the board are skipped
+                    const int lastRow = row + direction[0] * (length - 1);
+                    const int lastCol = col + direction[1] * (length - 1);
+                    if (lastRow >= rows || lastCol < 0 || lastCol >= cols) {
+                        continue;
+                    }
+                    int run = 1;
+                    while (run < length && gameState.at(row + direction[0] * run, col + direction[1] * run).position == player) {
+                        ++run;
+                    }
+                    if (run == length) {
+                        return player;
                     }
                 }
             }
         }
 
-        // If there are no empty cells or no player can win, the game is over
-        return !hasEmptyCells;
+        // No winner
+        return PlayerEnums::Unknown;
     }
-
 };
 
 #endif // TICTACTOERULES_H
@@ -11,13 +11,8 @@ CheckersGame::CheckersGame(QObject* parent)
     , gridSize_(QSize(8, 8)) // Standard checkers board size
 {
     // Install rules for the checkers game
-    rulesOfTheGame_ = new CheckersRules();
-
-    connect(this, &AbstractTableGame::gameOpenChanged, this, [this]() {
-        if (gameOpen()) {
-            updateVisuals();
-        }
-    });
+    installRules(new CheckersRules());
+    setBoardGeometry(QPointF(0, 0), QSizeF(100, 100)); // Cells drawn by drawGrid()
 
     drawGrid();
 }
@@ -27,9 +22,10 @@ CheckersGame::CheckersGame(QObject* parent)
 // --------------------------------------------
 
 void CheckersGame::initializeGame() {
-    cells_.clear();
-    clear();
-    drawGrid();
+    // The board is drawn once, startGame() removes the pieces of the previous game
+    if (cells_.rows() != gridSize_.height() || cells_.cols() != gridSize_.width()) {
+        drawGrid();
+    }
 }
 
 void CheckersGame::drawGrid() {
@@ -54,70 +50,39 @@ void CheckersGame::drawGrid() {
 // Update Visuals
 // --------------------------------------------
 
-void CheckersGame::updateVisuals() {
-    // Loop through the game state to add or update pieces
-    for (int row = 0; row < gameState_.rows(); ++row) {
-        for (int col = 0; col < gameState_.cols(); ++col) {
-            AbstractStrategyRulesGame::AtomicCellState cellState = gameState_.at(row, col);
-
-            if (cellState.position != PlayerEnums::Unknown) {
-                // If the piece doesn't already exist, create it
-                if (cellState.item == nullptr) {
-                    cellState.item = new QGraphicsEllipseItem(0, 0, 80, 80);
-                    addItem(cellState.item);
-                    gameState_[row][col].item = cellState.item; // Update game state with the new item
-                }
-
-                // Set the position of the piece
-                cellState.item->setPos(col * 100 + 10, row * 100 + 10);
-
-                // Set the color of the piece
-                QBrush brush((cellState.position == PlayerEnums::Player1) ? Qt::black : Qt::red);
-                cellState.item->setBrush(brush);
+void CheckersGame::updateCell(int row, int col) {
+    AbstractStrategyRulesGame::AtomicCellState cellState = getGameState().at(row, col);
+    QAbstractGraphicsShapeItem*& item = pieceItems_.at(row, col);
 
-                // Add a golden border if it's a king
-                if (cellState.typeId == 2) {
-                    QPen pen(Qt::yellow);
-                    pen.setWidth(4);
-                    cellState.item->setPen(pen);
-                } else {
-                    cellState.item->setPen(Qt::NoPen); // No border for regular pieces
-                }
-            }
+    // Remove the graphical item of an emptied cell (captured piece)
+    if (cellState.position == PlayerEnums::Unknown) {
+        if (item) {
+            removeItem(item);
+            delete item;
+            item = nullptr;
         }
+        return;
     }
 
-    // Clean up any orphaned graphical items
-    cleanUpGame();
-}
-
-// --------------------------------------------
-// Cleanup Logic
-// --------------------------------------------
+    // If the piece doesn't already exist, create it
+    if (item == nullptr) {
+        item = new QGraphicsEllipseItem(0, 0, 80, 80);
+        addItem(item); // The side table now owns the new item
+    }
 
-void CheckersGame::cleanUpGame() {
-    // Remove graphical items that are no longer in the game state
-    QList<QGraphicsItem*> allItems = items();
-    for (QGraphicsItem* item : allItems) {
-        if (QGraphicsEllipseItem* ellipse = dynamic_cast<QGraphicsEllipseItem*>(item)) {
-            bool found = false;
+    // Set the position of the piece
+    item->setPos(col * 100 + 10, row * 100 + 10);
 
-            // Check if the item is still in the game state
-            for (int row = 0; row < gameState_.rows(); ++row) {
-                for (int col = 0; col < gameState_.cols(); ++col) {
-                    if (gameState_.at(row, col).item == ellipse) {
-                        found = true;
-                        break;
-                    }
-                }
-                if (found) break;
-            }
+    // Set the color of the piece
+    QBrush brush((cellState.position == PlayerEnums::Player1) ? Qt::black : Qt::red);
+    item->setBrush(brush);
 
-            // If not found, remove it from the scene and delete it
-            if (!found) {
-                removeItem(ellipse);
-                delete ellipse;
-            }
-        }
+    // Add a golden border if it's a king
+    if (cellState.typeId == 2) {
+        QPen pen(Qt::yellow);
+        pen.setWidth(4);
+        item->setPen(pen);
+    } else {
+        item->setPen(Qt::NoPen); // No border for regular pieces
     }
 }
@@ -9,7 +9,8 @@ GoGames::GoGames(QObject* parent)
     : AbstractTableGame(parent)
     , gridSize_(QSize(9, 9)) // Default board size for Go (9x9)
 {
-    rulesOfTheGame_ = new GoRules();
+    installRules(new GoRules());
+    setBoardGeometry(QPointF(0, 0), QSizeF(50, 50)); // Cells drawn by drawGrid()
     drawGrid();
 }
 
@@ -19,9 +20,10 @@ GoGames::GoGames(QObject* parent)
 
 void GoGames::initializeGame()
 {
-    cells_.clear(); // Clear existing cells
-    clear();        // Clear the scene
-    drawGrid();     // Draw the initial grid
+    // The grid is drawn once, startGame() removes the stones of the previous game
+    if (cells_.rows() != gridSize_.height() || cells_.cols() != gridSize_.width()) {
+        drawGrid();
+    }
 }
 
 void GoGames::drawGrid()
@@ -47,37 +49,29 @@ void GoGames::drawGrid()
 // Update Visuals
 // --------------------------------------------
 
-void GoGames::updateVisuals()
+void GoGames::updateCell(int row, int col)
 {
-    // Remove all existing items from the scene (grid and stones)
-    for (auto item : items()) {
-        removeItem(item); // Remove item from the scene
-        delete item;      // Free memory
-    }
-
-    cells_.clear(nullptr); // Reset the cell matrix
-
-    // Redraw the grid
-    drawGrid();
-
-    // Add stones to match the current game state
-    for (int row = 0; row < gameState_.rows(); ++row) {
-        for (int col = 0; col < gameState_.cols(); ++col) {
-            PlayerEnums::PlayerPosition currentPlayer = gameState_.at(row, col).position;
-            if (currentPlayer != PlayerEnums::Unknown) {
-                // Create a graphical representation for the stone
-                QGraphicsEllipseItem* stone = new QGraphicsEllipseItem(0, 0, 40, 40); // Circular stone
+    PlayerEnums::PlayerPosition currentPlayer = getGameState().at(row, col).position;
+    QAbstractGraphicsShapeItem*& stone = pieceItems_.at(row, col);
 
-                // Set the stone color
-                stone->setBrush((currentPlayer == players_.at(0)->playerPosition()) ? Qt::black : Qt::white);
-                stone->setPen(QPen(Qt::black));
-
-                // Set absolute position in the scene
-                stone->setPos(col * 50 + 5, row * 50 + 5);
-
-                // Add the stone to the scene
-                addItem(stone);
-            }
+    if (currentPlayer == PlayerEnums::Unknown) {
+        // Captured or undone stone
+        if (stone) {
+            removeItem(stone);
+            delete stone;
+            stone = nullptr;
         }
+        return;
     }
+
+    if (stone == nullptr) {
+        // Create a graphical representation for the stone
+        stone = new QGraphicsEllipseItem(0, 0, 40, 40); // Circular stone
+        stone->setPen(QPen(Qt::black));
+        stone->setPos(col * 50 + 5, row * 50 + 5);
+        addItem(stone);
+    }
+
+    // Set the stone color
+    stone->setBrush((currentPlayer == session_.players().at(0)->playerPosition()) ? Qt::black : Qt::white);
 }
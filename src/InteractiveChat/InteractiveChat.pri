@@ -17,6 +17,7 @@ SOURCES += \
   
 HEADERS += \
     $$PWD/src/BubbleChat.h \
+    $$PWD/src/chatstyle.h \
     $$PWD/src/message.h \
     $$PWD/src/messagedelegate.h \
     $$PWD/src/messagemodel.h
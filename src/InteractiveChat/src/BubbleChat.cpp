@@ -2,16 +2,10 @@
 #include "messagedelegate.h"
 #include <QVBoxLayout>
 #include <QDateTime>
+#include <QScrollBar>
 
 BubbleChat::BubbleChat(QWidget *parent)
-    : QWidget(parent),
-    m_userBubbleColor("#930092"),
-    m_botBubbleColor("#6390FF"),
-    m_timestampColor(Qt::black),
-    m_textColor(Qt::white),
-    m_textSize(13),
-    m_timestampSize(7),
-    m_backgroundColor(Qt::white)
+    : QWidget(parent)
 {
     chatView = new QListView(this);
     messageModel = new MessageModel(this);
@@ -20,6 +14,35 @@ BubbleChat::BubbleChat(QWidget *parent)
     chatView->setModel(messageModel);
     chatView->setItemDelegate(new MessageDelegate(this));
 
+    // Older messages are fetched when the view reaches the top, and dropped again once it is back at the bottom
+    connect(chatView->verticalScrollBar(), &QScrollBar::valueChanged, this, [this](int value) {
+        QScrollBar *scrollBar = chatView->verticalScrollBar();
+        if (value == scrollBar->minimum())
+            fetchOlderMessages();
+        else if (value == scrollBar->maximum())
+            messageModel->trimFetched();
+    });
+    connect(chatView->verticalScrollBar(), &QScrollBar::rangeChanged, this, [this](int, int max) {
+        if (m_distanceFromBottom >= 0) {
+            chatView->verticalScrollBar()->setValue(max - m_distanceFromBottom);
+            m_distanceFromBottom = -1;
+        } else if (max == 0) {
+            QMetaObject::invokeMethod(this, &BubbleChat::fillView, Qt::QueuedConnection);
+        }
+    });
+
+    // Rows dropped above the history being read must not move it
+    connect(messageModel, &QAbstractItemModel::rowsAboutToBeRemoved, this, [this]() {
+        QScrollBar *scrollBar = chatView->verticalScrollBar();
+        if (scrollBar->value() != scrollBar->maximum())
+            m_topMessage = chatView->indexAt(QPoint(0, 0));
+    });
+    connect(messageModel, &QAbstractItemModel::rowsRemoved, this, [this]() {
+        if (m_topMessage.isValid())
+            chatView->scrollTo(m_topMessage, QAbstractItemView::PositionAtTop);
+        m_topMessage = QPersistentModelIndex();
+    });
+
     QVBoxLayout *layout = new QVBoxLayout(this);
     layout->addWidget(chatView);
     layout->setContentsMargins(0, 0, 0, 0);
@@ -31,76 +54,126 @@ BubbleChat::~BubbleChat()
 {
 }
 
-QColor BubbleChat::userBubbleColor() const { return m_userBubbleColor; }
+QColor BubbleChat::userBubbleColor() const { return messageModel->style().userBubbleColor; }
 void BubbleChat::setUserBubbleColor(const QColor &color) {
-    if (color != m_userBubbleColor) {
-        m_userBubbleColor = color;
+    if (color != messageModel->style().userBubbleColor) {
+        ChatStyle style = messageModel->style();
+        style.userBubbleColor = color;
+        messageModel->setStyle(style); // Restyles every message at once
         emit userBubbleColorChanged();
     }
 }
 
-QColor BubbleChat::botBubbleColor() const { return m_botBubbleColor; }
+QColor BubbleChat::botBubbleColor() const { return messageModel->style().botBubbleColor; }
 void BubbleChat::setBotBubbleColor(const QColor &color) {
-    if (color != m_botBubbleColor) {
-        m_botBubbleColor = color;
+    if (color != messageModel->style().botBubbleColor) {
+        ChatStyle style = messageModel->style();
+        style.botBubbleColor = color;
+        messageModel->setStyle(style); // Restyles every message at once
         emit botBubbleColorChanged();
     }
 }
 
-QColor BubbleChat::timestampColor() const { return m_timestampColor; }
+QColor BubbleChat::timestampColor() const { return messageModel->style().timestampColor; }
 void BubbleChat::setTimestampColor(const QColor &color) {
-    if (color != m_timestampColor) {
-        m_timestampColor = color;
+    if (color != messageModel->style().timestampColor) {
+        ChatStyle style = messageModel->style();
+        style.timestampColor = color;
+        messageModel->setStyle(style); // Restyles every message at once
         emit timestampColorChanged();
     }
 }
 
-QColor BubbleChat::textColor() const { return m_textColor; }
+QColor BubbleChat::textColor() const { return messageModel->style().textColor; }
 void BubbleChat::setTextColor(const QColor &color) {
-    if (color != m_textColor) {
-        m_textColor = color;
+    if (color != messageModel->style().textColor) {
+        ChatStyle style = messageModel->style();
+        style.textColor = color;
+        messageModel->setStyle(style); // Restyles every message at once
         emit textColorChanged();
     }
 }
 
-int BubbleChat::textSize() const { return m_textSize; }
+int BubbleChat::textSize() const { return messageModel->style().textSize; }
 void BubbleChat::setTextSize(int size) {
-    if (size != m_textSize) {
-        m_textSize = size;
+    if (size != messageModel->style().textSize) {
+        ChatStyle style = messageModel->style();
+        style.textSize = size;
+        messageModel->setStyle(style); // Restyles every message at once
         emit textSizeChanged();
     }
 }
 
-int BubbleChat::timestampSize() const { return m_timestampSize; }
+int BubbleChat::timestampSize() const { return messageModel->style().timestampSize; }
 void BubbleChat::setTimestampSize(int size) {
-    if (size != m_timestampSize) {
-        m_timestampSize = size;
+    if (size != messageModel->style().timestampSize) {
+        ChatStyle style = messageModel->style();
+        style.timestampSize = size;
+        messageModel->setStyle(style); // Restyles every message at once
         emit timestampSizeChanged();
     }
 }
 
-QColor BubbleChat::backgroundColor() const { return m_backgroundColor; }
+QColor BubbleChat::backgroundColor() const { return messageModel->style().backgroundColor; }
 void BubbleChat::setBackgroundColor(const QColor &color) {
-    if (color != m_backgroundColor) {
-        m_backgroundColor = color;
+    if (color != messageModel->style().backgroundColor) {
+        ChatStyle style = messageModel->style();
+        style.backgroundColor = color;
+        messageModel->setStyle(style); // Restyles every message at once
         emit backgroundColorChanged();
     }
 }
 
+bool BubbleChat::setHistoryFile(const QString &path) {
+    if (!messageModel->setLogFile(path))
+        return false;
+
+    // The view starts empty: load the latest messages of the file once it is laid out
+    QMetaObject::invokeMethod(this, &BubbleChat::fillView, Qt::QueuedConnection);
+    return true;
+}
+
+void BubbleChat::fetchOlderMessages() {
+    if (!messageModel->canFetchOlder())
+        return;
+
+    // Keep the visible messages in place while the older ones are inserted above them
+    QScrollBar *scrollBar = chatView->verticalScrollBar();
+    m_distanceFromBottom = scrollBar->maximum() - scrollBar->value();
+    messageModel->fetchOlder();
+}
+
+void BubbleChat::fillView() {
+    // A full window is enough to scroll; this also bounds the loop while the view is not laid out yet
+    QScrollBar *scrollBar = chatView->verticalScrollBar();
+    chatView->doItemsLayout();
+    while (scrollBar->maximum() == 0 && messageModel->canFetchOlder()
+           && messageModel->rowCount() < messageModel->capacity()) {
+        fetchOlderMessages();
+        chatView->doItemsLayout();
+    }
+}
+
 void BubbleChat::sendMessage(const QString &text) {
     QString timestamp = QDateTime::currentDateTime().toString("hh:mm AP");
     Message msg(text, timestamp, "user");
-    QVariantList styleParams;
-    styleParams << m_userBubbleColor << m_botBubbleColor << m_timestampColor << m_textColor << m_textSize << m_timestampSize << m_backgroundColor;
-    msg.setStyleParams(styleParams);
-    messageModel->addMessage(msg);
+    queueMessage(msg);
 }
 
 void BubbleChat::receiveMessage(const QString &text) {
     QString timestamp = QDateTime::currentDateTime().toString("hh:mm AP");
     Message msg(text, timestamp, "bot");
-    QVariantList styleParams;
-    styleParams << m_userBubbleColor << m_botBubbleColor << m_timestampColor << m_textColor << m_textSize << m_timestampSize << m_backgroundColor;
-    msg.setStyleParams(styleParams);
-    messageModel->addMessage(msg);
+    queueMessage(msg);
+}
+
+void BubbleChat::queueMessage(const Message &message) {
+    m_pendingMessages << message;
+    if (m_pendingMessages.size() == 1)
+        QMetaObject::invokeMethod(this, &BubbleChat::flushMessages, Qt::QueuedConnection);
+}
+
+void BubbleChat::flushMessages() {
+    QList<Message> messages;
+    messages.swap(m_pendingMessages);
+    messageModel->addMessages(messages);
 }
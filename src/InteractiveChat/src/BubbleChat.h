@@ -4,6 +4,7 @@
 #include <QWidget>
 #include <QListView>
 #include <QColor>
+#include <QPersistentModelIndex>
 #include "messagemodel.h"
 
 class BubbleChat : public QWidget
@@ -42,6 +43,9 @@ public:
     QColor backgroundColor() const;
     void setBackgroundColor(const QColor &color);
 
+    // Keeps the history in a persistent file; older messages are loaded when scrolling up
+    bool setHistoryFile(const QString &path);
+
 public slots:
     void sendMessage(const QString &text);
     void receiveMessage(const QString &text);
@@ -56,15 +60,18 @@ signals:
     void backgroundColorChanged();
 
 private:
+    void fetchOlderMessages();
+    // Fetches older pages until the view can scroll, so that its top can be reached
+    void fillView();
+    // Messages arriving in the same event loop pass are inserted together by flushMessages()
+    void queueMessage(const Message &message);
+    void flushMessages();
+
     QListView *chatView;
-    MessageModel *messageModel;
-    QColor m_userBubbleColor;
-    QColor m_botBubbleColor;
-    QColor m_timestampColor;
-    QColor m_textColor;
-    int m_textSize;
-    int m_timestampSize;
-    QColor m_backgroundColor;
+    MessageModel *messageModel; // Holds the chat style shared by the messages
+    int m_distanceFromBottom = -1; // Scroll position to restore once fetched messages are laid out
+    QPersistentModelIndex m_topMessage; // Kept at the top of the view while rows above it are removed
+    QList<Message> m_pendingMessages;
 };
 
 #endif // BubbleChat_H
@@ -0,0 +1,22 @@
+#ifndef CHATSTYLE_H
+#define CHATSTYLE_H
+
+#include <QColor>
+#include <QMetaType>
+
+// Colors and sizes of the chat bubbles.
+// The model holds one style shared by all the messages; a message only carries its own copy when it overrides it.
+struct ChatStyle
+{
+    QColor userBubbleColor = QColor("#930092");
+    QColor botBubbleColor = QColor("#6390FF");
+    QColor timestampColor = QColor(Qt::black);
+    QColor textColor = QColor(Qt::white);
+    int textSize = 13;
+    int timestampSize = 7;
+    QColor backgroundColor = QColor(Qt::white);
+};
+
+Q_DECLARE_METATYPE(const ChatStyle *)
+
+#endif // CHATSTYLE_H
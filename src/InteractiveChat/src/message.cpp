@@ -20,12 +20,36 @@ QString Message::role() const
     return m_role;
 }
 
-QVariantList Message::styleParams() const
+const ChatStyle *Message::styleOverride() const
 {
-    return m_styleParams;
+    return m_styleOverride.data();
 }
 
-void Message::setStyleParams(const QVariantList &styleParams)
+quint64 Message::id() const
 {
-    m_styleParams = styleParams;
+    return m_id;
+}
+
+int Message::styleRevision() const
+{
+    return m_styleRevision;
+}
+
+void Message::setStyleOverride(const ChatStyle &style)
+{
+    m_styleOverride = QSharedPointer<const ChatStyle>::create(style);
+    ++m_styleRevision;
+}
+
+void Message::clearStyleOverride()
+{
+    if (m_styleOverride) {
+        m_styleOverride.reset();
+        ++m_styleRevision;
+    }
+}
+
+void Message::setId(quint64 id)
+{
+    m_id = id;
 }
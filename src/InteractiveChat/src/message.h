@@ -2,7 +2,8 @@
 #define MESSAGE_H
 
 #include <QString>
-#include <QVariantList>
+#include <QSharedPointer>
+#include "chatstyle.h"
 
 class Message
 {
@@ -12,15 +13,21 @@ public:
     QString text() const;
     QString timestamp() const;
     QString role() const;
-    QVariantList styleParams() const;
+    const ChatStyle *styleOverride() const; // Null when the message uses the shared style
+    quint64 id() const;
+    int styleRevision() const;
 
-    void setStyleParams(const QVariantList &styleParams);
+    void setStyleOverride(const ChatStyle &style);
+    void clearStyleOverride();
+    void setId(quint64 id);
 
 private:
+    quint64 m_id = 0;
+    int m_styleRevision = 0; // Incremented on each style change, so cached layouts can be checked
     QString m_text;
     QString m_timestamp;
     QString m_role;
-    QVariantList m_styleParams;
+    QSharedPointer<const ChatStyle> m_styleOverride;
 };
 
 #endif // MESSAGE_H
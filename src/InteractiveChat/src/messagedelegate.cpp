@@ -1,117 +1,157 @@
 #include "messagedelegate.h"
 #include <QPainter>
 #include <QApplication>
-#include <QPainterPath>
 #include <QTextOption>
 #include <QDebug>
 
 MessageDelegate::MessageDelegate(QObject *parent)
     : QStyledItemDelegate(parent)
+    , m_geometries(2000)
+    , m_layouts(1000)
 {
 }
 
 void MessageDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const
 {
+    const BubbleLayout &bubble = layout(option, index);
+
     painter->save();
 
     // Enable antialiasing for smoother graphics
     painter->setRenderHint(QPainter::Antialiasing, true);
     painter->setRenderHint(QPainter::TextAntialiasing, true);
 
-    QString text = index.data(Qt::DisplayRole).toString();
-    QString timestamp = index.data(Qt::UserRole).toString();
-    QString role = index.data(Qt::UserRole + 1).toString();
-    QVariantList styleParams = index.data(Qt::UserRole + 2).toList();
-
-    QColor userBubbleColor = styleParams.value(0, QColor("#87CEEB")).value<QColor>();
-    QColor botBubbleColor = styleParams.value(1, QColor(Qt::gray)).value<QColor>();
-    QColor timestampColor = styleParams.value(2, QColor(Qt::lightGray)).value<QColor>();
-    QColor textColor = styleParams.value(3, QColor(Qt::white)).value<QColor>();
-    int textSize = styleParams.value(4, option.font.pointSize()).toInt();
-    int timestampSize = styleParams.value(5, option.font.pointSize() - 2).toInt();
-
-    QFont font = option.font;
-    font.setPointSize(textSize);
-    painter->setFont(font);
-    QFontMetrics fm(font);
-
-    QFont timestampFont = option.font;
-    timestampFont.setPointSize(timestampSize);
-    QFontMetrics timestampFm(timestampFont);
-
-    int maxBubbleWidth = option.rect.width() - 40; // Limit the width of the bubble to the view's width minus 40
-
-    // Calculate the text bounding rect
-    QTextOption textOption;
-    textOption.setWrapMode(QTextOption::WordWrap);
-    QRectF textRect = painter->boundingRect(QRect(0, 0, maxBubbleWidth - 20, 0), text, textOption);
-    int textBlockHeight = static_cast<int>(textRect.height());
-
-    // Calculate the total bubble height and width
-    int bubbleHeight = textBlockHeight + timestampFm.height() + 20; // 20 is for padding
-    int bubbleWidth = qMin(maxBubbleWidth, static_cast<int>(textRect.width()) + 20);
-
-    QRect bubbleRect = option.rect.adjusted(0, 0, 0, -10); // Add space between bubbles
-    if (role == "user") {
-        painter->setBrush(userBubbleColor);
-        bubbleRect.setLeft(bubbleRect.right() - bubbleWidth - 20);
+    const QSize bubbleSize = bubble.geometry.bubbleSize;
+    QRect bubbleRect(option.rect.topLeft(), bubbleSize);
+    if (bubble.isUser) {
+        bubbleRect.moveLeft(option.rect.right() - bubbleSize.width() - 20);
     } else {
-        painter->setBrush(botBubbleColor);
-        bubbleRect.setLeft(bubbleRect.left() + 20);
+        bubbleRect.moveLeft(option.rect.left() + 20);
     }
 
-    bubbleRect.setWidth(bubbleWidth);
-    bubbleRect.setHeight(bubbleHeight);
-
     // Draw shadow
-    QPainterPath path;
-    path.addRoundedRect(bubbleRect.adjusted(2, 2, 2, 2), 10, 10);
-    painter->fillPath(path, QColor(0, 0, 0, 50));
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(QColor(0, 0, 0, 50));
+    painter->drawRoundedRect(bubbleRect.adjusted(2, 2, 2, 2), 10, 10);
 
     // Draw bubble
-    painter->setPen(Qt::NoPen);
+    painter->setBrush(bubble.bubbleColor);
     painter->drawRoundedRect(bubbleRect, 10, 10);
 
     // Draw text
-    painter->setPen(textColor);
-    QRect textBubbleRect = bubbleRect.adjusted(10, 10, -10, -timestampFm.height() - 10);
-    painter->drawText(textBubbleRect, text, textOption);
+    painter->setPen(bubble.textColor);
+    painter->setFont(bubble.geometry.textFont);
+    painter->drawStaticText(bubbleRect.topLeft() + QPoint(10, 10), bubble.text);
 
     // Draw timestamp
-    painter->setPen(timestampColor);
-    painter->setFont(timestampFont);
-    QRect timestampRect;
-    if (role == "user") {
-        timestampRect = bubbleRect.adjusted(bubbleWidth - timestampFm.horizontalAdvance(timestamp) - 15, bubbleHeight - timestampFm.height() - 10, -10, -10);
-    } else {
-        timestampRect = bubbleRect.adjusted(10, bubbleHeight - timestampFm.height() - 10, -bubbleWidth + timestampFm.horizontalAdvance(timestamp) + 15, -10);
-    }
-    painter->drawText(timestampRect, timestamp);
+    painter->setPen(bubble.timestampColor);
+    painter->setFont(bubble.geometry.timestampFont);
+    painter->drawStaticText(bubbleRect.topLeft() + bubble.timestampOffset, bubble.timestamp);
 
     painter->restore();
 }
 
 QSize MessageDelegate::sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const
 {
+    // Only the height is needed here: the text is prepared when the row is painted
+    const BubbleGeometry &bubble = geometry(option, index);
+    return QSize(option.rect.width() - 40, bubble.bubbleSize.height() + 10);
+}
+
+const MessageDelegate::BubbleGeometry &MessageDelegate::geometry(const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    const LayoutKey key(index.data(Qt::UserRole + 3).toULongLong(), option.rect.width());
+    const int styleRevision = index.data(Qt::UserRole + 4).toInt();
+
+    // Reuse the geometry unless the style or the font changed
+    BubbleGeometry *bubble = m_geometries.object(key);
+    if (bubble && bubble->styleRevision == styleRevision && bubble->baseFont == option.font) {
+        return *bubble;
+    }
+
+    bubble = new BubbleGeometry;
+    bubble->styleRevision = styleRevision;
+    bubble->baseFont = option.font;
+
+    QString text = index.data(Qt::DisplayRole).toString();
+    const ChatStyle *style = index.data(Qt::UserRole + 2).value<const ChatStyle *>();
+    static const ChatStyle defaultStyle;
+    if (!style)
+        style = &defaultStyle;
+
     QFont font = option.font;
+    font.setPointSize(style->textSize);
+    QFontMetrics fm(font);
+
+    QFont timestampFont = option.font;
+    timestampFont.setPointSize(style->timestampSize);
+    QFontMetrics timestampFm(timestampFont);
+
+    int maxBubbleWidth = key.second - 40; // Limit the width of the bubble to the view's width minus 40
+
+    // Calculate the text bounding rect
+    QRect textRect = fm.boundingRect(QRect(0, 0, maxBubbleWidth - 20, 0), Qt::TextWordWrap, text);
+
+    // Calculate the total bubble height and width
+    int bubbleHeight = textRect.height() + timestampFm.height() + 20; // 20 is for padding
+    int bubbleWidth = qMin(maxBubbleWidth, textRect.width() + 20);
+    bubble->bubbleSize = QSize(bubbleWidth, bubbleHeight);
+    bubble->textFont = font;
+    bubble->timestampFont = timestampFont;
+
+    m_geometries.insert(key, bubble);
+    return *bubble;
+}
+
+const MessageDelegate::BubbleLayout &MessageDelegate::layout(const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    const LayoutKey key(index.data(Qt::UserRole + 3).toULongLong(), option.rect.width());
+    const int styleRevision = index.data(Qt::UserRole + 4).toInt();
+
+    // Reuse the layout unless the style or the font changed
+    BubbleLayout *bubble = m_layouts.object(key);
+    if (bubble && bubble->geometry.styleRevision == styleRevision && bubble->geometry.baseFont == option.font) {
+        return *bubble;
+    }
+
+    bubble = new BubbleLayout;
+    bubble->geometry = geometry(option, index);
+
     QString text = index.data(Qt::DisplayRole).toString();
-    QVariantList styleParams = index.data(Qt::UserRole + 2).toList();
-    int textSize = styleParams.value(4, option.font.pointSize()).toInt();
-    int timestampSize = styleParams.value(5, option.font.pointSize() - 2).toInt();
+    QString timestamp = index.data(Qt::UserRole).toString();
+    QString role = index.data(Qt::UserRole + 1).toString();
+    const ChatStyle *style = index.data(Qt::UserRole + 2).value<const ChatStyle *>();
+    static const ChatStyle defaultStyle;
+    if (!style)
+        style = &defaultStyle;
 
-    font.setPointSize(textSize);
-    QFontMetrics textMetrics(font);
+    bubble->isUser = role == "user";
+    bubble->bubbleColor = bubble->isUser ? style->userBubbleColor : style->botBubbleColor;
+    bubble->timestampColor = style->timestampColor;
+    bubble->textColor = style->textColor;
 
-    font.setPointSize(timestampSize);
-    QFontMetrics timestampMetrics(font);
+    const QSize bubbleSize = bubble->geometry.bubbleSize;
+    QFontMetrics timestampFm(bubble->geometry.timestampFont);
 
-    int maxBubbleWidth = option.rect.width() - 40;
     QTextOption textOption;
     textOption.setWrapMode(QTextOption::WordWrap);
-    QRectF textRect(0, 0, maxBubbleWidth - 20, 0);
-    QRectF boundedRect = textMetrics.boundingRect(textRect.toRect(), Qt::TextWordWrap, text);
-
-    int bubbleHeight = static_cast<int>(boundedRect.height()) + timestampMetrics.height() + 20;
+    bubble->text.setTextFormat(Qt::PlainText);
+    bubble->text.setTextOption(textOption);
+    bubble->text.setTextWidth(bubbleSize.width() - 20);
+    bubble->text.setText(text);
+    bubble->text.prepare(QTransform(), bubble->geometry.textFont);
+
+    bubble->timestamp.setTextFormat(Qt::PlainText);
+    bubble->timestamp.setText(timestamp);
+    bubble->timestamp.prepare(QTransform(), bubble->geometry.timestampFont);
+
+    int timestampTop = bubbleSize.height() - timestampFm.height() - 10;
+    if (bubble->isUser) {
+        bubble->timestampOffset = QPoint(bubbleSize.width() - timestampFm.horizontalAdvance(timestamp) - 15, timestampTop);
+    } else {
+        bubble->timestampOffset = QPoint(10, timestampTop);
+    }
 
-    return QSize(maxBubbleWidth, bubbleHeight + 10);
+    m_layouts.insert(key, bubble);
+    return *bubble;
 }
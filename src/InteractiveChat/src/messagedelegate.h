@@ -2,6 +2,12 @@
 #define MESSAGEDELEGATE_H
 
 #include <QStyledItemDelegate>
+#include <QCache>
+#include <QColor>
+#include <QFont>
+#include <QPair>
+#include <QStaticText>
+#include "chatstyle.h"
 
 class MessageDelegate : public QStyledItemDelegate
 {
@@ -12,6 +18,40 @@ public:
 
     void paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const override;
     QSize sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+
+private:
+    // Message id and view width a bubble was measured for
+    using LayoutKey = QPair<quint64, int>;
+
+    // Size and fonts of one bubble, valid for a font and a style revision; all sizeHint() needs
+    struct BubbleGeometry {
+        int styleRevision = 0;
+        QFont baseFont;
+
+        QSize bubbleSize;
+        QFont textFont;
+        QFont timestampFont;
+    };
+
+    // Geometry, colors and prepared text of one bubble, what paint() needs
+    struct BubbleLayout {
+        BubbleGeometry geometry;
+
+        bool isUser = false;
+        QColor bubbleColor;
+        QColor textColor;
+        QColor timestampColor;
+        QPoint timestampOffset; // Position of the timestamp relative to the top left of the bubble
+        QStaticText text;
+        QStaticText timestamp;
+    };
+
+    const BubbleGeometry &geometry(const QStyleOptionViewItem &option, const QModelIndex &index) const;
+    const BubbleLayout &layout(const QStyleOptionViewItem &option, const QModelIndex &index) const;
+
+    // Geometries and layouts by message id and width; only the recently shown rows are kept
+    mutable QCache<LayoutKey, BubbleGeometry> m_geometries;
+    mutable QCache<LayoutKey, BubbleLayout> m_layouts;
 };
 
 #endif // MESSAGEDELEGATE_H
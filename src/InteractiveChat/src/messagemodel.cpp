@@ -1,17 +1,194 @@
 #include "messagemodel.h"
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryFile>
 
 MessageModel::MessageModel(QObject *parent)
     : QAbstractListModel(parent)
 {
+    // The history of the session lives in a temporary file until a log file is set
+    QScopedPointer<QTemporaryFile> log(new QTemporaryFile);
+    if (log->open())
+        m_log.reset(log.take());
 }
 
 void MessageModel::addMessage(const Message &message)
 {
-    beginInsertRows(QModelIndex(), rowCount(), rowCount());
-    m_messages << message;
+    addMessages({ message });
+}
+
+void MessageModel::addMessages(const QList<Message> &messages)
+{
+    if (messages.isEmpty())
+        return;
+
+    // One write to the log for the whole batch
+    const QList<quint64> ids = writeToLog(messages);
+
+    // Only the latest messages fit in the window, the others are only in the log.
+    // When some are left out, the whole window makes room so that it stays contiguous.
+    const int kept = qMin(int(messages.size()), windowBound());
+    const int first = messages.size() - kept;
+    trimToCapacity(kept);
+
+    beginInsertRows(QModelIndex(), rowCount(), rowCount() + kept - 1);
+    for (int i = first; i < messages.size(); ++i) {
+        m_messages << messages.at(i);
+        m_messages.last().setId(ids.at(i));
+    }
+    if (m_log)
+        m_oldestOffset = qint64(m_messages.first().id() - 1);
+    endInsertRows();
+}
+
+bool MessageModel::canFetchOlder() const
+{
+    return m_log && m_oldestOffset > 0 && m_messages.size() < m_capacity + m_historyCapacity;
+}
+
+void MessageModel::fetchOlder()
+{
+    if (!canFetchOlder())
+        return;
+
+    qint64 start = m_oldestOffset;
+    const QList<Message> page = readLogBefore(m_oldestOffset, PageSize, start);
+    if (page.isEmpty()) {
+        m_oldestOffset = 0; // Unreadable log: stop fetching
+        return;
+    }
+
+    beginInsertRows(QModelIndex(), 0, page.size() - 1);
+    m_messages = page + m_messages;
+    m_oldestOffset = start;
+    m_fetchedRows += page.size();
     endInsertRows();
 }
 
+int MessageModel::capacity() const
+{
+    return m_capacity;
+}
+
+void MessageModel::setCapacity(int capacity)
+{
+    m_capacity = qMax(1, capacity);
+}
+
+int MessageModel::historyCapacity() const
+{
+    return m_historyCapacity;
+}
+
+void MessageModel::setHistoryCapacity(int capacity)
+{
+    m_historyCapacity = qMax(0, capacity);
+}
+
+void MessageModel::trimFetched()
+{
+    if (m_fetchedRows == 0)
+        return;
+
+    m_fetchedRows = 0;
+    trimToCapacity(0);
+}
+
+bool MessageModel::setLogFile(const QString &path)
+{
+    QScopedPointer<QFile> log(new QFile(path));
+    if (!log->open(QIODevice::ReadWrite))
+        return false;
+
+    beginResetModel();
+    m_messages.clear();
+    m_fetchedRows = 0;
+    m_log.reset(log.take());
+    m_oldestOffset = m_log->size(); // The messages of the file are fetched on demand
+    endResetModel();
+    return true;
+}
+
+int MessageModel::windowBound() const
+{
+    // Fetched pages are being read: they are only dropped past the second bound
+    return m_fetchedRows > 0 ? m_capacity + m_historyCapacity : m_capacity;
+}
+
+void MessageModel::trimToCapacity(int incoming)
+{
+    // Make room for the incoming messages; the dropped ones stay in the log.
+    const int excess = m_messages.size() - windowBound() + incoming;
+    if (excess <= 0)
+        return;
+
+    beginRemoveRows(QModelIndex(), 0, excess - 1);
+    m_messages.remove(0, excess);
+    m_fetchedRows = qMax(0, m_fetchedRows - excess);
+    if (m_log)
+        m_oldestOffset = m_messages.isEmpty() ? m_log->size() : qint64(m_messages.first().id() - 1);
+    endRemoveRows();
+}
+
+QList<quint64> MessageModel::writeToLog(const QList<Message> &messages)
+{
+    QList<quint64> ids;
+    ids.reserve(messages.size());
+    if (!m_log) {
+        for (int i = 0; i < messages.size(); ++i)
+            ids << m_nextId++;
+        return ids;
+    }
+
+    const qint64 offset = m_log->size();
+    QByteArray lines;
+    for (const Message &message : messages) {
+        // The offset of the line is a stable id, also for a message fetched again
+        ids << quint64(offset + lines.size()) + 1;
+        const QJsonObject line{ { "text", message.text() }, { "timestamp", message.timestamp() }, { "role", message.role() } };
+        lines += QJsonDocument(line).toJson(QJsonDocument::Compact) + '\n';
+    }
+    m_log->seek(offset);
+    m_log->write(lines);
+    m_log->flush();
+    return ids;
+}
+
+QList<Message> MessageModel::readLogBefore(qint64 end, int count, qint64 &start)
+{
+    // Read blocks backwards until the data holds count complete lines
+    qint64 position = end;
+    QByteArray data;
+    while (position > 0 && data.count('\n') <= count) {
+        const qint64 block = qMin<qint64>(4096, position);
+        position -= block;
+        m_log->seek(position);
+        data.prepend(m_log->read(block));
+    }
+
+    QList<QByteArray> lines = data.split('\n');
+    lines.removeLast(); // Empty: the data ends with a line break
+    if (position > 0)
+        lines.removeFirst(); // Partial line
+    if (lines.size() > count)
+        lines = lines.mid(lines.size() - count);
+
+    start = end;
+    for (const QByteArray &line : lines)
+        start -= line.size() + 1;
+
+    QList<Message> messages;
+    qint64 offset = start;
+    for (const QByteArray &line : lines) {
+        const QJsonObject object = QJsonDocument::fromJson(line).object();
+        Message message(object.value("text").toString(), object.value("timestamp").toString(), object.value("role").toString());
+        message.setId(quint64(offset) + 1);
+        messages << message;
+        offset += line.size() + 1;
+    }
+    return messages;
+}
+
 int MessageModel::rowCount(const QModelIndex &parent) const
 {
     Q_UNUSED(parent);
@@ -31,17 +208,47 @@ QVariant MessageModel::data(const QModelIndex &index, int role) const
     } else if (role == Qt::UserRole + 1) {
         return message.role();
     } else if (role == Qt::UserRole + 2) {
-        return message.styleParams();
+        // A pointer to the style, valid until the style changes
+        return QVariant::fromValue(message.styleOverride() ? message.styleOverride() : &m_style);
+    } else if (role == Qt::UserRole + 3) {
+        return message.id();
+    } else if (role == Qt::UserRole + 4) {
+        // Both revisions only grow, so their sum changes whenever the style of the message does
+        return m_styleRevision + message.styleRevision();
     }
 
     return QVariant();
 }
 
-void MessageModel::setMessageStyle(int index, const QVariantList &styleParams)
+void MessageModel::setMessageStyle(int index, const ChatStyle &style)
 {
     if (index < 0 || index >= m_messages.size())
         return;
 
-    m_messages[index].setStyleParams(styleParams);
-    emit dataChanged(this->index(index), this->index(index), {Qt::UserRole + 2});
+    m_messages[index].setStyleOverride(style);
+    emit dataChanged(this->index(index), this->index(index), {Qt::UserRole + 2, Qt::UserRole + 4});
+}
+
+void MessageModel::clearMessageStyle(int index)
+{
+    if (index < 0 || index >= m_messages.size())
+        return;
+
+    m_messages[index].clearStyleOverride();
+    emit dataChanged(this->index(index), this->index(index), {Qt::UserRole + 2, Qt::UserRole + 4});
+}
+
+const ChatStyle &MessageModel::style() const
+{
+    return m_style;
+}
+
+void MessageModel::setStyle(const ChatStyle &style)
+{
+    m_style = style;
+    ++m_styleRevision;
+
+    // One notification for the whole history
+    if (!m_messages.isEmpty())
+        emit dataChanged(index(0), index(m_messages.size() - 1), {Qt::UserRole + 2, Qt::UserRole + 4});
 }
@@ -2,8 +2,13 @@
 #define MESSAGEMODEL_H
 
 #include <QAbstractListModel>
+#include <QFile>
+#include <QScopedPointer>
 #include "message.h"
 
+// Chat history kept as a bounded window of the latest messages.
+// Every message is also appended to a log file, one JSON object per line; messages that leave
+// the window stay in the log and are read back a page at a time by fetchOlder().
 class MessageModel : public QAbstractListModel
 {
     Q_OBJECT
@@ -12,13 +17,57 @@ public:
     MessageModel(QObject *parent = nullptr);
 
     void addMessage(const Message &message);
+    // Inserts the messages as a single block of rows, so views lay out once per batch
+    void addMessages(const QList<Message> &messages);
 
     int rowCount(const QModelIndex &parent = QModelIndex()) const override;
     QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
-    void setMessageStyle(int index, const QVariantList &styleParams);
+
+    // Older messages are loaded from the log, at the top of the model.
+    // Not canFetchMore()/fetchMore(): views call them whenever the last row is visible,
+    // which in a chat kept scrolled to the bottom would load the whole log.
+    bool canFetchOlder() const;
+    void fetchOlder();
+
+    // Number of latest messages kept in memory
+    int capacity() const;
+    void setCapacity(int capacity);
+
+    // While fetched pages are in the model the window is not trimmed to capacity(), so the history
+    // being read stays in place; it may then grow by up to historyCapacity() rows.
+    // trimFetched() drops the fetched pages, once the view is back at the latest messages.
+    int historyCapacity() const;
+    void setHistoryCapacity(int capacity);
+    void trimFetched();
+
+    // Uses a persistent log instead of the default temporary file, its messages can be fetched.
+    // Returns false if the file cannot be opened. The messages already in the model are cleared.
+    bool setLogFile(const QString &path);
+
+    void setMessageStyle(int index, const ChatStyle &style);
+    void clearMessageStyle(int index);
+
+    // Style shared by every message without its own style
+    const ChatStyle &style() const;
+    void setStyle(const ChatStyle &style);
 
 private:
-    QList<Message> m_messages;
+    int windowBound() const;
+    void trimToCapacity(int incoming);
+    QList<quint64> writeToLog(const QList<Message> &messages);
+    QList<Message> readLogBefore(qint64 end, int count, qint64 &start);
+
+    static constexpr int PageSize = 50;
+
+    QList<Message> m_messages;        // Window of the latest messages, oldest first
+    int m_capacity = 500;
+    int m_historyCapacity = 5000;
+    int m_fetchedRows = 0;            // Rows at the top of the window loaded by fetchOlder()
+    QScopedPointer<QFile> m_log;      // Null if no log could be opened
+    qint64 m_oldestOffset = 0;        // Log offset of the oldest message of the window, log size when empty
+    ChatStyle m_style;
+    int m_styleRevision = 0;
+    quint64 m_nextId = 1;             // Ids of the messages when there is no log
 };
 
 #endif // MESSAGEMODEL_H
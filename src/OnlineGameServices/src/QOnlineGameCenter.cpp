@@ -137,9 +137,8 @@ void QOnlineGameCenter::setupConnections() {
     connect(m_wisperInterface, &QWisperInterface::newNotification, this, &QOnlineGameCenter::handleNewNotification);
     connect(m_wisperInterface, &QWisperInterface::userInformationChanged, this, &QOnlineGameCenter::_notifUserInformationChanged);
 
-    connect(m_wisperInterface, &QWisperInterface::newMessage, this, [](const QString &message) {
-        //TODO connecter le chat
-    });
+    // Seul le texte des messages est relayé : le chat regroupe lui-même les arrivées rapprochées
+    connect(m_wisperInterface, &QWisperInterface::newMessage, this, &QOnlineGameCenter::chatMessageReceived);
 
 }
 
@@ -50,6 +50,7 @@ signals:
     void newPlayerAdded(Player *player);
     void postUserInformation(QString property, QVariant information);
     void tableInformationChanged(const QJsonObject &);
+    void chatMessageReceived(const QString &message);
 
 private slots:
     void handleWebSocketConnected(QWebSocket *webSocket);
@@ -286,7 +286,10 @@ void QWisperInterface::onTextMessageReceived(const QString &message)
                 emit newNotification(newNotif);
             }
         }
-        emit newMessage(message);
+        else if (messsageObject.value("message").isString()) {
+            // Seul le texte du message de chat est transmis, pas la trame JSON
+            emit newMessage(messsageObject.value("message").toString());
+        }
     }
 }
 
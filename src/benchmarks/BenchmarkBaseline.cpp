@@ -0,0 +1,155 @@
+#include "BenchmarkBaseline.h"
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QFile>
+#include <QRegularExpression>
+#include <QTextStream>
+#include <QtTest>
+
+// --------------------------------------------
+// Files
+// --------------------------------------------
+
+BenchmarkBaseline::Results BenchmarkBaseline::read(const QString &path, bool *ok) {
+    Results results;
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        if (ok) {
+            *ok = false;
+        }
+        return results;
+    }
+
+    // "function","tag","metric",value per iteration,... ; other lines are comments
+    static const QRegularExpression line(QStringLiteral("^\"([^\"]*)\",\"([^\"]*)\",\"([^\"]*)\",([^,]+)"));
+    QTextStream in(&file);
+    while (!in.atEnd()) {
+        const QRegularExpressionMatch match = line.match(in.readLine());
+        if (match.hasMatch()) {
+            const QString key = match.captured(1) + '/' + match.captured(2) + '/' + match.captured(3);
+            results.insert(key, match.captured(4).toDouble());
+        }
+    }
+    if (ok) {
+        *ok = true;
+    }
+    return results;
+}
+
+bool BenchmarkBaseline::write(const Results &results, const QString &path) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text | QIODevice::Truncate)) {
+        return false;
+    }
+
+    QTextStream out(&file);
+    out << "# Benchmark baseline, regenerate with: GameCenterBenchmarks --save-baseline <this file>\n";
+    for (auto it = results.cbegin(); it != results.cend(); ++it) {
+        const QStringList parts = it.key().split('/');
+        out << '"' << parts.value(0) << "\",\"" << parts.value(1) << "\",\"" << parts.value(2) << "\","
+            << QString::number(it.value(), 'g', 13) << "\n";
+    }
+    return true;
+}
+
+// --------------------------------------------
+// Comparison
+// --------------------------------------------
+
+QVector<BenchmarkBaseline::Comparison> BenchmarkBaseline::compare(const Results &baseline, const Results &current, double thresholdPercent) {
+    QVector<Comparison> comparisons;
+    for (auto it = current.cbegin(); it != current.cend(); ++it) {
+        Comparison comparison;
+        comparison.benchmark = it.key();
+        comparison.current = it.value();
+        comparison.baseline = baseline.value(it.key(), 0.0);
+        if (comparison.baseline > 0.0) {
+            comparison.change = 100.0 * (comparison.current - comparison.baseline) / comparison.baseline;
+            comparison.regression = comparison.change > thresholdPercent;
+        }
+        comparisons.append(comparison);
+    }
+    return comparisons;
+}
+
+// --------------------------------------------
+// Runner
+// --------------------------------------------
+
+int BenchmarkBaseline::exec(QObject *benchmarks, const QStringList &arguments) {
+    QStringList testArguments;
+    QString savePath;
+    QString comparePath;
+    double threshold = 10.0;
+    for (int i = 0; i < arguments.size(); ++i) {
+        const QString &argument = arguments.at(i);
+        const bool hasValue = i + 1 < arguments.size();
+        if (argument == "--save-baseline" && hasValue) {
+            savePath = arguments.at(++i);
+        } else if (argument == "--compare" && hasValue) {
+            comparePath = arguments.at(++i);
+        } else if (argument == "--threshold" && hasValue) {
+            threshold = arguments.at(++i).toDouble();
+        } else {
+            testArguments.append(argument);
+        }
+    }
+
+    if (savePath.isEmpty() && comparePath.isEmpty()) {
+        return QTest::qExec(benchmarks, testArguments);
+    }
+
+    // Results go both to the console and to a CSV file read back afterwards
+    const QString resultsPath = QDir::temp().filePath(
+        QString("%1-%2.csv").arg(QCoreApplication::applicationName()).arg(QCoreApplication::applicationPid()));
+    testArguments << "-o" << resultsPath + ",csv" << "-o" << "-,txt";
+    const int status = QTest::qExec(benchmarks, testArguments);
+
+    bool ok = false;
+    const Results current = read(resultsPath, &ok);
+    QFile::remove(resultsPath);
+    QTextStream out(stdout);
+    if (!ok || current.isEmpty()) {
+        out << "No benchmark result was recorded\n";
+        return status != 0 ? status : 1;
+    }
+
+    if (!savePath.isEmpty()) {
+        if (!write(current, savePath)) {
+            out << "Cannot write the baseline " << savePath << "\n";
+            return 1;
+        }
+        out << "Baseline saved to " << savePath << "\n";
+    }
+
+    int regressions = 0;
+    if (!comparePath.isEmpty()) {
+        const Results baseline = read(comparePath, &ok);
+        if (!ok) {
+            out << "Cannot read the baseline " << comparePath << "\n";
+            return 1;
+        }
+
+        out << "\nComparison with " << comparePath << " (threshold " << threshold << "%)\n";
+        for (const Comparison &comparison : compare(baseline, current, threshold)) {
+            out << "  " << comparison.benchmark.leftJustified(56)
+                << QString::number(comparison.baseline, 'g', 4).rightJustified(12)
+                << QString::number(comparison.current, 'g', 4).rightJustified(12);
+            if (comparison.baseline <= 0.0) {
+                out << "         new\n";
+                continue;
+            }
+            out << QString::asprintf("%+10.1f%%", comparison.change)
+                << (comparison.regression ? "  REGRESSION" : "") << "\n";
+            regressions += comparison.regression ? 1 : 0;
+        }
+        out << regressions << " regression(s)\n";
+    }
+    out.flush();
+
+    if (status != 0) {
+        return status;
+    }
+    return regressions > 0 ? 1 : 0;
+}
@@ -0,0 +1,67 @@
+#ifndef BENCHMARKBASELINE_H
+#define BENCHMARKBASELINE_H
+
+#include <QMap>
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/**
+ * @class BenchmarkBaseline
+ * @brief Saves QtTest benchmark results as a baseline and compares later runs against it.
+ *
+ * Results are read from the QtTest CSV logger, one line per benchmark:
+ * `"function","tag","metric",value per iteration,total,iterations`.
+ * A result is a regression when it is slower than its baseline by more than
+ * the threshold.
+ */
+class BenchmarkBaseline {
+public:
+    /**
+     * @brief Benchmark results, keyed by "function/tag/metric", valued per iteration.
+     */
+    using Results = QMap<QString, double>;
+
+    /**
+     * @brief One benchmark of a comparison.
+     */
+    struct Comparison {
+        QString benchmark;
+        double baseline = 0.0;  ///< Baseline value, 0 if the benchmark is new.
+        double current = 0.0;
+        double change = 0.0;    ///< Relative change in percent, positive when slower.
+        bool regression = false;
+    };
+
+    /**
+     * @brief Reads results written by the QtTest CSV logger (or a saved baseline).
+     * @param path The CSV file.
+     * @param ok Receives false if the file cannot be read.
+     */
+    static Results read(const QString &path, bool *ok = nullptr);
+
+    /**
+     * @brief Writes results as a baseline file.
+     * @return False if the file cannot be written.
+     */
+    static bool write(const Results &results, const QString &path);
+
+    /**
+     * @brief Compares results against a baseline.
+     * @param thresholdPercent Slowdown tolerated before a result is a regression.
+     */
+    static QVector<Comparison> compare(const Results &baseline, const Results &current, double thresholdPercent);
+
+    /**
+     * @brief Runs a benchmark object, saving or comparing its results on request.
+     *
+     * Besides the QtTest arguments, understands `--save-baseline <file>`,
+     * `--compare <file>` and `--threshold <percent>` (10 by default).
+     *
+     * @return The QtTest exit code, or 1 if a benchmark regressed.
+     */
+    static int exec(QObject *benchmarks, const QStringList &arguments);
+};
+
+#endif // BENCHMARKBASELINE_H
@@ -0,0 +1,393 @@
+#include <QCoreApplication>
+#include <QtTest>
+#include <memory>
+#include <random>
+#include "BenchmarkBaseline.h"
+#include "GameCatalogModel.h"
+#include "bots/RandomBot.h"
+#include "framework/types/QCircularList.h"
+#include "framework/types/QMatrix.h"
+#include "games/AbstractGame/GameSession.h"
+#include "games/AbstractGame/Perft.h"
+#include "games/CheckersRules.h"
+#include "games/GoBoard.h"
+#include "games/GoRules.h"
+#include "games/TicTacToeRules.h"
+
+using State = AbstractStrategyRulesGame::State;
+
+namespace {
+
+// Fixed seed: every run measures the same positions
+constexpr unsigned Seed = 20240613;
+
+// Go board filled with legal stones of alternating colors up to the requested density
+State crowdedGoBoard(int size, double density) {
+    std::mt19937 random(Seed);
+    GoBoard board(size, size);
+    PlayerEnums::PlayerPosition color = PlayerEnums::Player1;
+    const int target = int(size * size * density);
+    for (int attempt = 0; attempt < 100 * size * size && size * size - board.emptyCount() < target; ++attempt) {
+        const int p = board.point(int(random() % size), int(random() % size));
+        if (board.isLegal(p, color)) {
+            board.play(p, color);
+            color = color == PlayerEnums::Player1 ? PlayerEnums::Player2 : PlayerEnums::Player1;
+        }
+    }
+
+    State state(size, size, { PlayerEnums::Unknown, 0 });
+    for (int row = 0; row < size; ++row) {
+        for (int col = 0; col < size; ++col) {
+            state.at(row, col) = { board.stoneAt(board.point(row, col)), 0 };
+        }
+    }
+    return state;
+}
+
+// Board without any winning line: marks are dropped at random and undone if they complete a line
+State crowdedKInARowBoard(const TicTacToeRules &rules, int size, double density) {
+    std::mt19937 random(Seed);
+    State state = rules.initStatePlayers(size, size);
+    PlayerEnums::PlayerPosition player = PlayerEnums::Player1;
+    for (int placed = 0, attempt = 0; placed < int(size * size * density) && attempt < 100 * size * size; ++attempt) {
+        const int row = int(random() % size);
+        const int col = int(random() % size);
+        if (state.at(row, col).position != PlayerEnums::Unknown) {
+            continue;
+        }
+        state.at(row, col) = { player, 0 };
+        if (rules.checkWin(state) != PlayerEnums::Unknown) {
+            state.at(row, col) = { PlayerEnums::Unknown, 0 };
+            continue;
+        }
+        player = player == PlayerEnums::Player1 ? PlayerEnums::Player2 : PlayerEnums::Player1;
+        ++placed;
+    }
+    return state;
+}
+
+// Checkers position after a number of plies, with a fixed choice among the generated moves
+State checkersAfter(const CheckersRules &rules, int plies, PlayerEnums::PlayerPosition &toMove) {
+    State state = rules.initStatePlayers(8, 8);
+    toMove = PlayerEnums::Player1;
+    CheckersBitboard::MoveList moves;
+    for (int ply = 0; ply < plies; ++ply) {
+        rules.generateMoves(state, toMove, moves);
+        if (moves.isEmpty()) {
+            break;
+        }
+        const CheckersBitboard::Move &first = moves.at(ply % moves.size());
+        Move move(QPoint(CheckersBitboard::colOf(first.from), CheckersBitboard::rowOf(first.from)),
+                  QPoint(CheckersBitboard::colOf(first.to), CheckersBitboard::rowOf(first.to)), toMove);
+        rules.apply(state, move);
+        toMove = toMove == PlayerEnums::Player1 ? PlayerEnums::Player2 : PlayerEnums::Player1;
+    }
+    return state;
+}
+
+} // namespace
+
+/**
+ * @class GameCenterBenchmarks
+ * @brief Micro-benchmarks of the framework types and of the hot paths of the rules and bots.
+ */
+class GameCenterBenchmarks : public QObject {
+    Q_OBJECT
+
+private slots:
+    // --------------------------------------------
+    // QMatrix
+    // --------------------------------------------
+
+    void matrixCopy_data() {
+        QTest::addColumn<int>("size");
+        QTest::newRow("8x8") << 8;
+        QTest::newRow("19x19") << 19;
+    }
+
+    void matrixCopy() {
+        QFETCH(int, size);
+        const State source(size, size, { PlayerEnums::Player1, 1 });
+        State copy;
+        QBENCHMARK {
+            copy = source;
+            copy.at(0, 0) = { PlayerEnums::Player2, 0 }; // Forces the detach
+        }
+    }
+
+    void matrixAccess_data() {
+        QTest::addColumn<int>("size");
+        QTest::newRow("19x19") << 19;
+        QTest::newRow("64x64") << 64;
+    }
+
+    void matrixAccess() {
+        QFETCH(int, size);
+        const QMatrix<int> matrix(size, size, 1);
+        int sum = 0;
+        QBENCHMARK {
+            for (int row = 0; row < size; ++row) {
+                for (int col = 0; col < size; ++col) {
+                    sum += matrix.at(row, col);
+                }
+            }
+        }
+        QVERIFY(sum > 0);
+    }
+
+    void matrixMultiply_data() {
+        QTest::addColumn<int>("size");
+        QTest::newRow("8x8") << 8;
+        QTest::newRow("64x64") << 64;
+    }
+
+    void matrixMultiply() {
+        QFETCH(int, size);
+        const QMatrix<int> left(size, size, 2);
+        const QMatrix<int> right(size, size, 3);
+        QMatrix<int> product;
+        QBENCHMARK {
+            product = left * right;
+        }
+        QCOMPARE(product.at(0, 0), 6 * size);
+    }
+
+    // --------------------------------------------
+    // QCircularList
+    // --------------------------------------------
+
+    void circularListNext_data() { addListSizes(); }
+    void circularListNext() {
+        QFETCH(int, count);
+        QCircularList<int> list;
+        for (int i = 0; i < count; ++i) {
+            list.append(i);
+        }
+        int last = 0;
+        QBENCHMARK {
+            for (int i = 0; i < 1000; ++i) {
+                last = list.next();
+            }
+        }
+        QVERIFY(last >= 0);
+    }
+
+    void circularListContains_data() { addListSizes(); }
+    void circularListContains() {
+        QFETCH(int, count);
+        QCircularList<int> list;
+        for (int i = 0; i < count; ++i) {
+            list.append(i);
+        }
+        bool found = true;
+        QBENCHMARK {
+            for (int i = 0; i < 1000; ++i) {
+                found &= list.contains(i % count);
+            }
+        }
+        QVERIFY(found);
+    }
+
+    void circularListRemove_data() { addListSizes(); }
+    void circularListRemove() {
+        QFETCH(int, count);
+        QCircularList<int> list;
+        for (int i = 0; i < count; ++i) {
+            list.append(i);
+        }
+        QBENCHMARK {
+            // Removes the oldest element and appends it back, the size stays constant
+            for (int i = 0; i < count; ++i) {
+                list.remove(i);
+                list.append(i);
+            }
+        }
+        QCOMPARE(list.size(), count);
+    }
+
+    // --------------------------------------------
+    // Rules
+    // --------------------------------------------
+
+    void goIsMoveValid_data() {
+        QTest::addColumn<int>("size");
+        QTest::newRow("9x9 crowded") << 9;
+        QTest::newRow("19x19 crowded") << 19;
+    }
+
+    // Every empty point of a board filled at 70%, as the scene asks the rules
+    void goIsMoveValid() {
+        QFETCH(int, size);
+        GoRules rules;
+        const State before = crowdedGoBoard(size, 0.7);
+        rules.resetPositionHistory(before);
+        Player player;
+        player.setPlayerPosition(PlayerEnums::Player1);
+
+        QVector<State> candidates;
+        for (int row = 0; row < size; ++row) {
+            for (int col = 0; col < size; ++col) {
+                if (before.at(row, col).position == PlayerEnums::Unknown) {
+                    State after = before;
+                    after.at(row, col) = { PlayerEnums::Player1, 0 };
+                    candidates.append(after);
+                }
+            }
+        }
+        QVERIFY(!candidates.isEmpty());
+
+        State after;
+        int valid = 0;
+        QBENCHMARK {
+            for (const State &candidate : candidates) {
+                after = candidate;
+                valid += rules.isMoveValid(before, after, &player) ? 1 : 0;
+            }
+        }
+        QVERIFY(valid > 0);
+    }
+
+    void checkersIsMoveValid_data() {
+        QTest::addColumn<int>("plies");
+        QTest::newRow("opening") << 0;
+        QTest::newRow("middle game") << 20;
+    }
+
+    // Every generated move of the side to move, as the scene asks the rules
+    void checkersIsMoveValid() {
+        QFETCH(int, plies);
+        CheckersRules rules;
+        PlayerEnums::PlayerPosition toMove = PlayerEnums::Player1;
+        const State before = checkersAfter(rules, plies, toMove);
+        Player player;
+        player.setPlayerPosition(toMove);
+
+        CheckersBitboard::MoveList moves;
+        rules.generateMoves(before, toMove, moves);
+        QVector<State> candidates;
+        for (const CheckersBitboard::Move &generated : moves) {
+            Move move(QPoint(CheckersBitboard::colOf(generated.from), CheckersBitboard::rowOf(generated.from)),
+                      QPoint(CheckersBitboard::colOf(generated.to), CheckersBitboard::rowOf(generated.to)), toMove);
+            State after = before;
+            rules.apply(after, move);
+            candidates.append(after);
+        }
+        QVERIFY(!candidates.isEmpty());
+
+        State after;
+        int valid = 0;
+        QBENCHMARK {
+            for (const State &candidate : candidates) {
+                after = candidate;
+                valid += rules.isMoveValid(before, after, &player) ? 1 : 0;
+            }
+        }
+        QVERIFY(valid > 0);
+    }
+
+    void ticTacToeIsGameOver_data() {
+        QTest::addColumn<int>("size");
+        QTest::addColumn<int>("winLength");
+        QTest::newRow("Tic Tac Toe 4x4") << 4 << 0;
+        QTest::newRow("Gomoku 15x15") << 15 << 5;
+    }
+
+    // Crowded board without a winner: the whole board is scanned
+    void ticTacToeIsGameOver() {
+        QFETCH(int, size);
+        QFETCH(int, winLength);
+        const TicTacToeRules rules(size, size, winLength);
+        const State state = crowdedKInARowBoard(rules, size, 0.6);
+        bool over = true;
+        QBENCHMARK {
+            over = rules.isGameOver(state);
+        }
+        QVERIFY(!over);
+    }
+
+    void perft_data() {
+        QTest::addColumn<int>("game");
+        QTest::addColumn<int>("depth");
+        QTest::addColumn<quint64>("nodes");
+        const GameCatalogModel catalog;
+        QTest::newRow("Go depth 2") << catalog.indexOf("Go") << 2 << quint64(6480);
+        QTest::newRow("Tic Tac Toe depth 4") << catalog.indexOf("Tic Tac Toe") << 4 << quint64(43680);
+        QTest::newRow("Gomoku depth 2") << catalog.indexOf("Gomoku") << 2 << quint64(50400);
+        QTest::newRow("Checkers depth 6") << catalog.indexOf("Checkers") << 6 << quint64(36768);
+    }
+
+    // Move generation, apply and unapply over a whole game tree from the start position
+    void perft() {
+        QFETCH(int, game);
+        QFETCH(int, depth);
+        QFETCH(quint64, nodes);
+        const GameCatalogModel catalog;
+        const std::unique_ptr<AbstractStrategyRulesGame> rules = catalog.rulesFactory(game)();
+        const QSize boardSize = catalog.boardSize(game);
+        const State start = rules->initStatePlayers(boardSize.height(), boardSize.width());
+        rules->resetPositionHistory(start);
+
+        Perft::Result result;
+        QBENCHMARK {
+            result = Perft::run(*rules, start, PlayerEnums::Player1, depth);
+        }
+        QCOMPARE(result.nodes, nodes);
+    }
+
+    // --------------------------------------------
+    // Bots
+    // --------------------------------------------
+
+    void randomBotGame_data() {
+        QTest::addColumn<int>("game");
+        const GameCatalogModel catalog;
+        for (int row = 0; row < catalog.rowCount(); ++row) {
+            QTest::newRow(qPrintable(catalog.name(row))) << row;
+        }
+    }
+
+    // A whole game between two random bots, the thinking RandomBot::play() does for each move
+    void randomBotGame() {
+        QFETCH(int, game);
+        const GameCatalogModel catalog;
+        const std::unique_ptr<AbstractStrategyRulesGame> rules = catalog.rulesFactory(game)();
+        const QSize boardSize = catalog.boardSize(game);
+        const int maxPlies = 4 * boardSize.width() * boardSize.height();
+
+        RandomBot first;
+        RandomBot second;
+        GameSession session(rules.get());
+        session.addPlayer(&first);
+        session.addPlayer(&second);
+        const ThinkingToken token;
+
+        int plies = 0;
+        QBENCHMARK {
+            session.start(boardSize.height(), boardSize.width());
+            for (int ply = 0; ply < maxPlies && session.isOpen(); ++ply) {
+                Player *player = session.currentPlayer();
+                auto *bot = static_cast<AbstractBot *>(player);
+                if (!session.play(bot->think(*rules, session.state(), player->playerPosition(), token))) {
+                    break; // No legal move left
+                }
+                ++plies;
+            }
+        }
+        QVERIFY(plies > 0);
+    }
+
+private:
+    static void addListSizes() {
+        QTest::addColumn<int>("count");
+        QTest::newRow("2") << 2;
+        QTest::newRow("64") << 64;
+    }
+};
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    GameCenterBenchmarks benchmarks;
+    return BenchmarkBaseline::exec(&benchmarks, app.arguments());
+}
+
+#include "GameCenterBenchmarks.moc"
@@ -1,11 +1,129 @@
 #include "FireworksAnimation.h"
+#include <QPainter>
+
+namespace {
+constexpr int UpdateInterval = 16;       // Particle update period in ms (about 60 frames per second)
+constexpr float FadePerSecond = 1.0f;    // A particle lives one second
+}
+
+// --------------------------------------------
+// Particle Pool
+// --------------------------------------------
+
+FireworksParticles::FireworksParticles()
+    : count_(0) {}
+
+void FireworksParticles::spawn(float x, float y, float vx, float vy, float size, QRgb color) {
+    // Grow the arrays only when the pool is full
+    if (count_ == x_.size()) {
+        const int capacity = qMax(256, 2 * count_);
+        x_.resize(capacity);
+        y_.resize(capacity);
+        vx_.resize(capacity);
+        vy_.resize(capacity);
+        alpha_.resize(capacity);
+        size_.resize(capacity);
+        color_.resize(capacity);
+    }
+
+    x_[count_] = x;
+    y_[count_] = y;
+    vx_[count_] = vx;
+    vy_[count_] = vy;
+    alpha_[count_] = 1.0f;
+    size_[count_] = size;
+    color_[count_] = color;
+    ++count_;
+}
+
+void FireworksParticles::step(float seconds) {
+    const int count = count_;
+    float* x = x_.data();
+    float* y = y_.data();
+    float* vx = vx_.data();
+    float* vy = vy_.data();
+    float* alpha = alpha_.data();
+    float* size = size_.data();
+    QRgb* color = color_.data();
+    const float fade = FadePerSecond * seconds;
+
+    // Independent element-wise updates: the compiler can vectorize this loop
+    for (int i = 0; i < count; ++i) {
+        x[i] += vx[i] * seconds;
+        y[i] += vy[i] * seconds;
+        alpha[i] -= fade;
+    }
+
+    // Compact the live particles at the front of the arrays
+    int live = 0;
+    for (int i = 0; i < count; ++i) {
+        if (alpha[i] > 0.0f) {
+            if (live != i) {
+                x[live] = x[i];
+                y[live] = y[i];
+                vx[live] = vx[i];
+                vy[live] = vy[i];
+                alpha[live] = alpha[i];
+                size[live] = size[i];
+                color[live] = color[i];
+            }
+            ++live;
+        }
+    }
+    count_ = live;
+
+    updateBounds();
+}
+
+void FireworksParticles::clear() {
+    count_ = 0;
+    updateBounds();
+}
+
+void FireworksParticles::updateBounds() {
+    QRectF bounds;
+    if (count_ > 0) {
+        float left = x_[0], top = y_[0], right = x_[0] + size_[0], bottom = y_[0] + size_[0];
+        for (int i = 1; i < count_; ++i) {
+            left = qMin(left, x_[i]);
+            top = qMin(top, y_[i]);
+            right = qMax(right, x_[i] + size_[i]);
+            bottom = qMax(bottom, y_[i] + size_[i]);
+        }
+        bounds = QRectF(left, top, right - left, bottom - top);
+    }
+
+    // The old area must be repainted as well as the new one
+    prepareGeometryChange();
+    bounds_ = bounds;
+    update();
+}
+
+void FireworksParticles::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) {
+    Q_UNUSED(option)
+    Q_UNUSED(widget)
+
+    painter->setPen(Qt::NoPen);
+    for (int i = 0; i < count_; ++i) {
+        QColor color = QColor::fromRgb(color_[i]);
+        color.setAlphaF(alpha_[i]);
+        painter->setBrush(color);
+        painter->drawEllipse(QRectF(x_[i], y_[i], size_[i], size_[i]));
+    }
+}
+
+// --------------------------------------------
+// Animation
+// --------------------------------------------
 
 FireworksAnimation::FireworksAnimation(QWidget* parent)
     : QGraphicsView(parent),
     scene_(new QGraphicsScene(this)),
     timer_(new QTimer(this)),
+    particles_(new FireworksParticles()),
     particleCount_(100),
     fireworksEnabled_(true) {
+    scene_->addItem(particles_); // Owned by the scene
     setScene(scene_);
     setStyleSheet("background: transparent;");
     setRenderHint(QPainter::Antialiasing);
@@ -24,12 +142,13 @@ void FireworksAnimation::startAnimation(int time, const QString& text, bool enab
     // and stops the animation after the specified duration.
 
     // Reset the scene and enable or disable fireworks
-    scene_->clear();
+    clearScene();
     fireworksEnabled_ = enableFireworks;
 
     // Start the fireworks effect if enabled
     if (fireworksEnabled_) {
-        timer_->start(50); // Update every 50 ms
+        clock_.start();
+        timer_->start(UpdateInterval);
         for (int i = 0; i < time / 1000; ++i) {
             QTimer::singleShot(i * 500, this, &FireworksAnimation::createFirework);
         }
@@ -46,7 +165,7 @@ void FireworksAnimation::startAnimation(int time, const QString& text, bool enab
     // Stop the animation after the specified duration
     QTimer::singleShot(time, this, [this]() {
         timer_->stop();
-        scene_->clear();
+        clearScene();
         hide();
         emit animationFinished();
     });
@@ -70,53 +189,35 @@ void FireworksAnimation::createFirework() {
     for (int i = 0; i < particleCount_; ++i) {
         // Generate random properties for each particle
         double angle = QRandomGenerator::global()->bounded(360) * M_PI / 180.0;
-        double speed = QRandomGenerator::global()->bounded(3.0) + 2.0;
+        double speed = (QRandomGenerator::global()->bounded(3.0) + 2.0) * 20.0; // 40 to 100 pixels per second
         int size = QRandomGenerator::global()->bounded(3, 7);
+        QRgb color = qRgb(QRandomGenerator::global()->bounded(255),
+                          QRandomGenerator::global()->bounded(255),
+                          QRandomGenerator::global()->bounded(255));
 
-        // Create a particle with random size and color
-        QGraphicsEllipseItem* particle = new QGraphicsEllipseItem(0, 0, size, size);
-        particle->setBrush(QBrush(QColor::fromRgb(
-            QRandomGenerator::global()->bounded(255),
-            QRandomGenerator::global()->bounded(255),
-            QRandomGenerator::global()->bounded(255))));
-
-        // Set particle data for movement and origin
-        particle->setData(0, x);  // Original X position
-        particle->setData(1, y);  // Original Y position
-        particle->setData(2, speed * cos(angle)); // X velocity
-        particle->setData(3, speed * sin(angle)); // Y velocity
-        particle->setOpacity(1.0);
-
-        // Position the particle and add it to the scene
-        particle->setPos(x, y);
-        scene_->addItem(particle);
+        particles_->spawn(x, y, speed * cos(angle), speed * sin(angle), size, color);
     }
 }
 
 
 void FireworksAnimation::updateParticles() {
-    // Updates the position and opacity of particles in the scene.
-    // Removes particles when their opacity reaches zero.
+    // Updates the position and opacity of the particles by the elapsed time,
+    // so the animation keeps its speed when frames are late.
     // Skips updates if fireworks are disabled.
 
     if (!fireworksEnabled_) return;
 
-    for (QGraphicsItem* item : scene_->items()) {
-        QGraphicsEllipseItem* particle = dynamic_cast<QGraphicsEllipseItem*>(item);
-        if (particle) {
-            // Update particle position
-            double dx = particle->data(2).toDouble();
-            double dy = particle->data(3).toDouble();
-            particle->moveBy(dx, dy);
-
-            // Reduce opacity and remove particle if fully transparent
-            particle->setOpacity(particle->opacity() - 0.05);
-            if (particle->opacity() <= 0) {
-                scene_->removeItem(particle);
-                delete particle;
-            }
-        }
-    }
+    const float seconds = clock_.restart() / 1000.0f;
+    particles_->step(seconds);
+}
+
+
+void FireworksAnimation::clearScene() {
+    // Keep the particle item, delete everything else (the winning message)
+    scene_->removeItem(particles_);
+    scene_->clear();
+    particles_->clear();
+    scene_->addItem(particles_);
 }
 
 
@@ -4,12 +4,68 @@
 #include <QGraphicsView>
 #include <QGraphicsScene>
 #include <QTimer>
-#include <QGraphicsEllipseItem>
+#include <QElapsedTimer>
+#include <QGraphicsItem>
 #include <QGraphicsTextItem>
+#include <QVector>
 #include <QRandomGenerator>
 #include <QGraphicsOpacityEffect>
 #include <QPropertyAnimation>
 
+/**
+ * @class FireworksParticles
+ * @brief A pool of firework particles drawn by a single scene item.
+ *
+ * Particles are stored as a structure of arrays (positions, velocities,
+ * alpha, size, color), so a step is one loop over contiguous floats and
+ * dead particles are compacted in place. The arrays only grow to the peak
+ * particle count, and the whole pool is painted in one paint() call.
+ */
+class FireworksParticles : public QGraphicsItem {
+public:
+    FireworksParticles();
+
+    /**
+     * @brief Adds a particle to the pool.
+     * @param x Initial X position.
+     * @param y Initial Y position.
+     * @param vx X velocity in pixels per second.
+     * @param vy Y velocity in pixels per second.
+     * @param size Diameter of the particle.
+     * @param color Color of the particle.
+     */
+    void spawn(float x, float y, float vx, float vy, float size, QRgb color);
+
+    /**
+     * @brief Moves and fades the particles, then removes the transparent ones.
+     * @param seconds Time elapsed since the previous step.
+     */
+    void step(float seconds);
+
+    /**
+     * @brief Removes every particle.
+     */
+    void clear();
+
+    int count() const { return count_; }
+
+    QRectF boundingRect() const override { return bounds_; }
+    void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) override;
+
+private:
+    void updateBounds();
+
+    int count_;             ///< Number of live particles, at the front of the arrays
+    QVector<float> x_;      ///< X positions
+    QVector<float> y_;      ///< Y positions
+    QVector<float> vx_;     ///< X velocities (pixels per second)
+    QVector<float> vy_;     ///< Y velocities (pixels per second)
+    QVector<float> alpha_;  ///< Opacities, the particle dies at 0
+    QVector<float> size_;   ///< Diameters
+    QVector<QRgb> color_;   ///< Colors
+    QRectF bounds_;         ///< Area covered by the live particles
+};
+
 /**
  * @class FireworksAnimation
  * @brief A class to display fireworks and a winning message.
@@ -34,6 +90,8 @@ signals:
 private:
     QGraphicsScene* scene_; ///< The graphics scene for the animation
     QTimer* timer_; ///< Timer to update the particles
+    QElapsedTimer clock_; ///< Time since the previous particle update
+    FireworksParticles* particles_; ///< Particles of all the fireworks, kept in the scene
     int particleCount_; ///< Number of particles per firework
     bool fireworksEnabled_; ///< Indicates whether fireworks are enabled
 
@@ -50,11 +108,16 @@ private:
      * @brief Updates the position and opacity of particles.
      *
      * This method is called periodically to move particles based on their
-     * velocity and reduce their opacity. Particles are removed when they
-     * become fully transparent.
+     * velocity and reduce their opacity, scaled by the time elapsed since the
+     * previous call. Particles are removed when they become fully transparent.
      */
     void updateParticles();
 
+    /**
+     * @brief Removes the particles and the message, keeping the particle item in the scene.
+     */
+    void clearScene();
+
     /**
      * @brief Displays a winning message with animations.
      *
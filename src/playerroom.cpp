@@ -7,6 +7,7 @@
 #include <QDateTime>
 #include <QJsonArray>
 #include <QResizeEvent>
+#include <QShortcut>
 
 
 PlayerRoom::PlayerRoom(QWidget *parent)
@@ -26,6 +27,31 @@ PlayerRoom::PlayerRoom(QWidget *parent)
 
     playerSeatMap_.insert(PlayerEnums::Player1, ui->widgetGameSeat1);
     playerSeatMap_.insert(PlayerEnums::Player2, ui->widgetGameSeat2);
+
+    // Takeback and replay through the game history
+    connect(new QShortcut(QKeySequence::Undo, this), &QShortcut::activated, this, [this]() {
+        if (!currentGame_ || !currentGame_->undo()) {
+            return;
+        }
+        // Bots play as soon as it is their turn: take their moves back too
+        while (currentGame_->canUndo() && dynamic_cast<AbstractBot*>(currentGame_->currentPlayer())) {
+            currentGame_->undo();
+        }
+    });
+    connect(new QShortcut(QKeySequence::Redo, this), &QShortcut::activated, this, [this]() {
+        if (currentGame_) {
+            currentGame_->redo();
+        }
+    });
+
+    // Asks the thinking bot to play its best move found so far
+    connect(new QShortcut(QKeySequence(Qt::CTRL | Qt::Key_M), this), &QShortcut::activated, this, [this]() {
+        if (currentGame_) {
+            if (auto* bot = dynamic_cast<AbstractBot*>(currentGame_->currentPlayer())) {
+                bot->moveNow();
+            }
+        }
+    });
 }
 
 PlayerRoom::~PlayerRoom()
@@ -325,6 +351,13 @@ void PlayerRoom::clearRoom()
 
 void PlayerRoom::resetGame()
 {
+    // Bots still thinking about the old game drop their move
+    for (Player* player : playerManagementMap_.keys()) {
+        if (auto* bot = dynamic_cast<AbstractBot*>(player)) {
+            bot->setGame(nullptr);
+        }
+    }
+
     if (currentGame_) {
         // Detaches the current game scene from the graphics view.
         ui->graphicsView->setScene(nullptr);
@@ -0,0 +1,279 @@
+#include "Tournament.h"
+
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QThreadPool>
+#include <QtConcurrent>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include "games/AbstractGame/GameSession.h"
+#include "games/GoBoard.h"
+
+namespace {
+
+// Elo difference matching an expected score
+double eloOf(double score) {
+    return -400.0 * std::log10(1.0 / score - 1.0);
+}
+
+// Value at a percentile of sorted samples (nearest rank)
+qint64 percentile(const QVector<qint64> &sorted, double fraction) {
+    if (sorted.isEmpty()) {
+        return 0;
+    }
+    const int rank = qBound(0, int(std::ceil(fraction * sorted.size())) - 1, sorted.size() - 1);
+    return sorted.at(rank);
+}
+
+QString milliseconds(qint64 microseconds) {
+    return QString::number(microseconds / 1000.0, 'f', 2);
+}
+
+void printLatency(const QString &bot, const QVector<qint64> &sorted, QTextStream &out) {
+    qint64 total = 0;
+    for (qint64 latency : sorted) {
+        total += latency;
+    }
+    const qint64 mean = sorted.isEmpty() ? 0 : total / sorted.size();
+
+    out << "  " << bot.leftJustified(12)
+        << milliseconds(sorted.isEmpty() ? 0 : sorted.first()).rightJustified(9)
+        << milliseconds(percentile(sorted, 0.50)).rightJustified(9)
+        << milliseconds(percentile(sorted, 0.90)).rightJustified(9)
+        << milliseconds(percentile(sorted, 0.99)).rightJustified(9)
+        << milliseconds(sorted.isEmpty() ? 0 : sorted.last()).rightJustified(9)
+        << milliseconds(mean).rightJustified(9) << "\n";
+}
+
+void printHistogram(const QString &bot, const QVector<qint64> &sorted, QTextStream &out) {
+    // Bucket upper bounds in microseconds, the last bucket is open
+    static const QVector<qint64> bounds = { 100, 1000, 10000, 50000, 100000, 200000, 500000, 1000000 };
+    static const QStringList labels = { "< 0.1 ms", "< 1 ms", "< 10 ms", "< 50 ms", "< 100 ms", "< 200 ms", "< 500 ms", "< 1 s", ">= 1 s" };
+    const int barWidth = 40;
+
+    QVector<int> counts(labels.size(), 0);
+    for (qint64 latency : sorted) {
+        const int bucket = std::upper_bound(bounds.begin(), bounds.end(), latency) - bounds.begin();
+        ++counts[bucket];
+    }
+    const int largest = *std::max_element(counts.begin(), counts.end());
+
+    out << "  " << bot << "\n";
+    for (int bucket = 0; bucket < counts.size(); ++bucket) {
+        if (counts.at(bucket) == 0) {
+            continue;
+        }
+        const int bar = qMax(1, counts.at(bucket) * barWidth / largest);
+        out << "    " << labels.at(bucket).leftJustified(10) << QString::number(counts.at(bucket)).rightJustified(8)
+            << "  " << QString(bar, QLatin1Char('#')) << "\n";
+    }
+}
+
+} // namespace
+
+// --------------------------------------------
+// Report
+// --------------------------------------------
+
+double Tournament::Report::score() const {
+    return games() > 0 ? (wins + 0.5 * draws) / games() : 0.5;
+}
+
+bool Tournament::Report::elo(double &difference, double &low, double &high) const {
+    const double mean = score();
+    if (games() == 0 || mean <= 0.0 || mean >= 1.0) {
+        return false;
+    }
+
+    // Normal approximation of the mean game score, bounds kept inside ]0, 1[
+    const double variance = (wins * (1.0 - mean) * (1.0 - mean)
+                             + draws * (0.5 - mean) * (0.5 - mean)
+                             + losses * mean * mean) / games();
+    const double margin = 1.96 * std::sqrt(variance / games());
+    const double epsilon = 1e-6;
+
+    difference = eloOf(mean);
+    low = eloOf(qMax(epsilon, mean - margin));
+    high = eloOf(qMin(1.0 - epsilon, mean + margin));
+    return true;
+}
+
+// --------------------------------------------
+// Match
+// --------------------------------------------
+
+Tournament::Tournament(const Settings &settings)
+    : settings_(settings)
+{
+    gameRow_ = catalog_.indexOf(settings_.game);
+}
+
+bool Tournament::isValid(QString &error) const {
+    if (gameRow_ < 0) {
+        error = QString("Unknown game \"%1\"").arg(settings_.game);
+        return false;
+    }
+    const QStringList bots = BotRegistry::names();
+    for (const QString &bot : { settings_.botA, settings_.botB }) {
+        if (!bots.contains(bot)) {
+            error = QString("Unknown bot \"%1\"").arg(bot);
+            return false;
+        }
+    }
+    if (settings_.games < 1 || settings_.jobs < 1) {
+        error = "The number of games and of jobs must be positive";
+        return false;
+    }
+    return true;
+}
+
+Tournament::Report Tournament::run(const std::function<void(int finished)> &progress) {
+    QVector<GameRecord> records(settings_.games);
+    for (int i = 0; i < records.size(); ++i) {
+        records[i].index = i;
+    }
+
+    QElapsedTimer clock;
+    clock.start();
+
+    // Each job pulls the next game until all are played
+    std::atomic<int> nextGame{ 0 };
+    std::atomic<int> finished{ 0 };
+    QMutex progressMutex;
+    QThreadPool pool;
+    pool.setMaxThreadCount(settings_.jobs);
+    for (int job = 0; job < settings_.jobs; ++job) {
+        QtConcurrent::run(&pool, [&]() {
+            for (int game = nextGame++; game < records.size(); game = nextGame++) {
+                playGame(records[game]);
+                const int done = ++finished;
+                if (progress) {
+                    QMutexLocker lock(&progressMutex);
+                    progress(done);
+                }
+            }
+        });
+    }
+    pool.waitForDone();
+
+    Report report;
+    report.elapsedMs = clock.elapsed();
+    for (const GameRecord &record : records) {
+        if (record.scoreA > 0.5) {
+            ++report.wins;
+        } else if (record.scoreA < 0.5) {
+            ++report.losses;
+        } else {
+            ++report.draws;
+        }
+        report.adjudicated += record.adjudicated ? 1 : 0;
+        report.forfeits += record.forfeit ? 1 : 0;
+        report.plies += record.plies;
+        report.latencyA += record.latencyA;
+        report.latencyB += record.latencyB;
+    }
+    std::sort(report.latencyA.begin(), report.latencyA.end());
+    std::sort(report.latencyB.begin(), report.latencyB.end());
+    return report;
+}
+
+void Tournament::playGame(GameRecord &record) const {
+    const std::unique_ptr<AbstractStrategyRulesGame> rules = catalog_.rulesFactory(gameRow_)();
+    const QSize boardSize = catalog_.boardSize(gameRow_);
+    const bool isGo = dynamic_cast<const GoRules *>(rules.get()) != nullptr;
+    const std::unique_ptr<AbstractBotEngine> engineA = BotRegistry::create(settings_.botA, settings_.bot);
+    const std::unique_ptr<AbstractBotEngine> engineB = BotRegistry::create(settings_.botB, settings_.bot);
+    Player botA;
+    Player botB;
+
+    // The bots swap colors every game
+    const bool aOpens = record.index % 2 == 0;
+    GameSession session(rules.get());
+    session.addPlayer(aOpens ? &botA : &botB);
+    session.addPlayer(aOpens ? &botB : &botA);
+    session.start(boardSize.height(), boardSize.width());
+
+    const int maxPlies = settings_.maxPlies > 0 ? settings_.maxPlies : 4 * boardSize.width() * boardSize.height();
+    PlayerEnums::PlayerPosition winner = PlayerEnums::Unknown;
+    bool decided = false;
+    QElapsedTimer timer;
+
+    while (session.isOpen() && record.plies < maxPlies) {
+        const bool aPlays = session.currentPlayer() == &botA;
+        const PlayerEnums::PlayerPosition player = (aPlays ? botA : botB).playerPosition();
+        const PlayerEnums::PlayerPosition opponent = (aPlays ? botB : botA).playerPosition();
+
+        ThinkingToken token;
+        timer.start();
+        const Move move = (aPlays ? engineA : engineB)->think(*rules, session.state(), player, token);
+        (aPlays ? record.latencyA : record.latencyB).append(timer.nsecsElapsed() / 1000);
+
+        if (move.player == PlayerEnums::Unknown) {
+            // No legal move: a Go player passes and the board is scored, elsewhere the blocked player loses
+            if (!isGo) {
+                winner = opponent;
+                decided = true;
+            }
+            break;
+        }
+        if (!session.play(move)) {
+            record.forfeit = true;
+            winner = opponent;
+            decided = true;
+            break;
+        }
+        ++record.plies;
+    }
+
+    if (!decided) {
+        record.adjudicated = session.isOpen();
+        winner = session.winner();
+        if (isGo && winner == PlayerEnums::Unknown) {
+            // Go rules never name a winner: area scoring with komi
+            const double score = GoBoard::fromState(session.state()).areaScore() - settings_.komi;
+            winner = score > 0 ? PlayerEnums::Player1 : PlayerEnums::Player2;
+        }
+    }
+
+    if (winner == PlayerEnums::Unknown) {
+        record.scoreA = 0.5;
+    } else {
+        record.scoreA = winner == botA.playerPosition() ? 1.0 : 0.0;
+    }
+}
+
+// --------------------------------------------
+// Output
+// --------------------------------------------
+
+void Tournament::print(const Report &report, QTextStream &out) const {
+    out << settings_.botA << " vs " << settings_.botB << " on " << settings_.game << ": "
+        << report.games() << " games, " << settings_.jobs << " at a time, "
+        << settings_.bot.timeBudget << " ms per move\n\n";
+
+    out << "  Win/Draw/Loss  " << report.wins << " / " << report.draws << " / " << report.losses
+        << "   score " << QString::number(report.score() * 100.0, 'f', 1) << "%\n";
+
+    double difference = 0.0;
+    double low = 0.0;
+    double high = 0.0;
+    if (report.elo(difference, low, high)) {
+        out << "  Elo            " << QString::asprintf("%+.1f  [%+.1f, %+.1f] (95%%)", difference, low, high) << "\n";
+    } else {
+        out << "  Elo            " << (report.score() > 0.5 ? "+inf" : "-inf") << " (no game lost by one side)\n";
+    }
+    out << "  Adjudicated    " << report.adjudicated << ", forfeits " << report.forfeits << "\n";
+    out << "  Moves          " << report.plies << " in " << QString::number(report.elapsedMs / 1000.0, 'f', 2)
+        << " s, " << QString::number(report.movesPerSecond(), 'f', 1) << " moves/s\n\n";
+
+    out << "  Latency (ms)" << QString("min").rightJustified(9) << QString("p50").rightJustified(9)
+        << QString("p90").rightJustified(9) << QString("p99").rightJustified(9)
+        << QString("max").rightJustified(9) << QString("mean").rightJustified(9) << "\n";
+    printLatency(settings_.botA, report.latencyA, out);
+    printLatency(settings_.botB, report.latencyB, out);
+    out << "\n";
+    printHistogram(settings_.botA, report.latencyA, out);
+    printHistogram(settings_.botB, report.latencyB, out);
+    out.flush();
+}
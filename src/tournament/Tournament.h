@@ -0,0 +1,107 @@
+#ifndef TOURNAMENT_H
+#define TOURNAMENT_H
+
+#include <QSize>
+#include <QString>
+#include <QTextStream>
+#include <QVector>
+#include <functional>
+#include "games/RulesCatalog.h"
+#include "bots/BotRegistry.h"
+
+/**
+ * @class Tournament
+ * @brief Plays a match between two registered bots on a catalog game, without any scene.
+ *
+ * Each game runs in its own GameSession with its own bot engines, so games
+ * are spread over a pool of threads. The bots swap colors every game. The
+ * result is reported from the first bot's point of view: win/draw/loss, Elo
+ * difference with its 95% confidence interval, moves per second and the
+ * distribution of the thinking time per move of each bot.
+ */
+class Tournament {
+public:
+    /**
+     * @brief Settings of a match.
+     */
+    struct Settings {
+        QString botA;                    ///< Registered name of the first bot.
+        QString botB;                    ///< Registered name of the second bot.
+        QString game = "Tic Tac Toe";    ///< Catalog name of the game.
+        int games = 100;                 ///< Number of games to play.
+        int jobs = 1;                    ///< Games played at the same time.
+        int maxPlies = 0;                ///< Moves after which a game is adjudicated, 0 for four times the board area.
+        double komi = 7.5;               ///< Points given to the second player when a Go game is scored.
+        BotRegistry::Options bot;        ///< Settings applied to both bots.
+    };
+
+    /**
+     * @brief Outcome of one game.
+     */
+    struct GameRecord {
+        int index = 0;                   ///< Game number, even games are opened by the first bot.
+        double scoreA = 0.5;             ///< 1 if the first bot won, 0.5 on a draw, 0 if it lost.
+        int plies = 0;                   ///< Moves played.
+        bool adjudicated = false;        ///< The game was stopped by the move limit or a pass and then scored.
+        bool forfeit = false;            ///< A bot returned an illegal move and lost the game.
+        QVector<qint64> latencyA;        ///< Thinking time of each move of the first bot, in microseconds.
+        QVector<qint64> latencyB;        ///< Thinking time of each move of the second bot, in microseconds.
+    };
+
+    /**
+     * @brief Aggregated result of a match.
+     */
+    struct Report {
+        int wins = 0;
+        int draws = 0;
+        int losses = 0;
+        int adjudicated = 0;
+        int forfeits = 0;
+        qint64 plies = 0;
+        qint64 elapsedMs = 0;            ///< Wall-clock time of the whole match.
+        QVector<qint64> latencyA;        ///< Sorted thinking times of the first bot, in microseconds.
+        QVector<qint64> latencyB;        ///< Sorted thinking times of the second bot, in microseconds.
+
+        int games() const { return wins + draws + losses; }
+        double score() const;            ///< Mean score of the first bot (0 to 1).
+
+        /**
+         * @brief Elo difference of the first bot over the second, with its 95% confidence bounds.
+         * @return False if the score is 0 or 1 (the difference is then unbounded).
+         */
+        bool elo(double &difference, double &low, double &high) const;
+
+        double movesPerSecond() const { return elapsedMs > 0 ? plies * 1000.0 / elapsedMs : 0.0; }
+    };
+
+    explicit Tournament(const Settings &settings);
+
+    /**
+     * @brief Checks the settings against the catalog and the bot registry.
+     * @param error Receives the reason when the settings are not usable.
+     */
+    bool isValid(QString &error) const;
+
+    /**
+     * @brief Plays the match.
+     * @param progress Called after each finished game with the number of finished games, from the worker threads.
+     */
+    Report run(const std::function<void(int finished)> &progress = {});
+
+    /**
+     * @brief Writes a human readable report.
+     */
+    void print(const Report &report, QTextStream &out) const;
+
+private:
+    /**
+     * @brief Plays one game and fills its record.
+     */
+    void playGame(GameRecord &record) const;
+
+    Settings settings_;
+    RulesCatalog catalog_;
+    int gameRow_ = -1;                   ///< Catalog row of the game.
+};
+
+#endif // TOURNAMENT_H
@@ -0,0 +1,101 @@
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QTextStream>
+#include <QThread>
+#include "Tournament.h"
+#include "games/AbstractGame/Perft.h"
+
+int main(int argc, char* argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("BotTournament");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Plays a match between two bots and reports their results and Elo difference.");
+    parser.addHelpOption();
+    parser.addPositionalArgument("botA", "First bot, reported as the winner of a positive Elo difference.");
+    parser.addPositionalArgument("botB", "Second bot.");
+
+    const QCommandLineOption gameOption({ "g", "game" }, "Catalog game to play.", "name", "Tic Tac Toe");
+    const QCommandLineOption gamesOption({ "n", "games" }, "Number of games.", "count", "100");
+    const QCommandLineOption jobsOption({ "j", "jobs" }, "Games played at the same time (default: all cores).", "count",
+                                        QString::number(QThread::idealThreadCount()));
+    const QCommandLineOption timeOption({ "t", "time" }, "Thinking time per move of the searching bots.", "ms", "100");
+    const QCommandLineOption threadsOption("bot-threads", "Search threads of each parallel bot.", "count", "1");
+    const QCommandLineOption pliesOption("max-plies", "Moves after which a game is adjudicated (default: four times the board area).", "count", "0");
+    const QCommandLineOption komiOption("komi", "Komi used to score Go games.", "points", "7.5");
+    const QCommandLineOption listOption({ "l", "list" }, "Lists the registered bots and the catalog games.");
+    const QCommandLineOption perftOption("perft", "Counts the legal move sequences of the game up to a depth instead of playing.", "depth");
+    parser.addOptions({ gameOption, gamesOption, jobsOption, timeOption, threadsOption, pliesOption, komiOption, listOption, perftOption });
+    parser.process(app);
+
+    QTextStream out(stdout);
+    QTextStream err(stderr);
+
+    if (parser.isSet(listOption)) {
+        out << "Bots:\n";
+        for (const QString& bot : BotRegistry::names()) {
+            out << "  " << bot << "\n";
+        }
+        out << "Games:\n";
+        const RulesCatalog catalog;
+        for (int row = 0; row < catalog.size(); ++row) {
+            out << "  " << catalog.name(row) << "\n";
+        }
+        return 0;
+    }
+
+    if (parser.isSet(perftOption)) {
+        const RulesCatalog catalog;
+        const int row = catalog.indexOf(parser.value(gameOption));
+        if (row < 0) {
+            err << "Unknown game \"" << parser.value(gameOption) << "\"\n";
+            return 1;
+        }
+
+        const std::unique_ptr<AbstractStrategyRulesGame> rules = catalog.rulesFactory(row)();
+        const QSize boardSize = catalog.boardSize(row);
+        const AbstractStrategyRulesGame::State start = rules->initStatePlayers(boardSize.height(), boardSize.width());
+        rules->resetPositionHistory(start);
+        for (int depth = 1; depth <= parser.value(perftOption).toInt(); ++depth) {
+            const Perft::Result result = Perft::run(*rules, start, PlayerEnums::Player1, depth);
+            out << "perft(" << depth << ") = " << result.nodes << "   "
+                << QString::number(result.elapsedNs / 1e6, 'f', 1) << " ms   "
+                << QString::number(result.nodesPerSecond(), 'f', 0) << " nodes/s\n";
+            out.flush();
+        }
+        return 0;
+    }
+
+    const QStringList bots = parser.positionalArguments();
+    if (bots.size() != 2) {
+        parser.showHelp(1);
+    }
+
+    Tournament::Settings settings;
+    settings.botA = bots.at(0);
+    settings.botB = bots.at(1);
+    settings.game = parser.value(gameOption);
+    settings.games = parser.value(gamesOption).toInt();
+    settings.jobs = parser.value(jobsOption).toInt();
+    settings.maxPlies = parser.value(pliesOption).toInt();
+    settings.komi = parser.value(komiOption).toDouble();
+    settings.bot.timeBudget = parser.value(timeOption).toInt();
+    settings.bot.threads = parser.value(threadsOption).toInt();
+
+    Tournament tournament(settings);
+    QString error;
+    if (!tournament.isValid(error)) {
+        err << error << "\n";
+        return 1;
+    }
+
+    const Tournament::Report report = tournament.run([&err, &settings](int finished) {
+        err << "\rGame " << finished << "/" << settings.games;
+        err.flush();
+    });
+    err << "\n";
+    err.flush();
+
+    tournament.print(report, out);
+    return 0;
+}